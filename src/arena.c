@@ -0,0 +1,88 @@
+#include <stdlib.h>
+
+#include "arena.h"
+
+#ifdef AUP_WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS   MAP_ANON
+#endif
+#ifndef MAP_NORESERVE
+#define MAP_NORESERVE   0
+#endif
+#endif
+
+// Granularity memory is committed at on Windows.
+#define COMMIT_SIZE     (64 * 1024)
+
+static struct {
+    char  *base;
+    char  *bump;
+    char  *end;
+    char  *committed;
+} m_arena;
+
+// Only the pages touched get backed by memory.
+bool aup_initArena(size_t size)
+{
+#ifdef AUP_WIN32
+    char *base = VirtualAlloc(NULL, size, MEM_RESERVE, PAGE_READWRITE);
+    if (base == NULL) return false;
+#else
+    char *base = mmap(NULL, size, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (base == MAP_FAILED) return false;
+#endif
+
+    m_arena.base = base;
+    m_arena.bump = base;
+    m_arena.end = base + size;
+    m_arena.committed = base;
+    return true;
+}
+
+void aup_freeArena()
+{
+    if (m_arena.base == NULL) return;
+
+#ifdef AUP_WIN32
+    VirtualFree(m_arena.base, 0, MEM_RELEASE);
+#else
+    munmap(m_arena.base, m_arena.end - m_arena.base);
+#endif
+    m_arena.base = m_arena.bump = m_arena.end = NULL;
+    m_arena.committed = NULL;
+}
+
+void *aup_arenaAlloc(size_t size)
+{
+    size = (size + 7) & ~(size_t)7;
+    if (m_arena.base == NULL || size > (size_t)(m_arena.end - m_arena.bump)) {
+        return NULL;
+    }
+
+    char *ptr = m_arena.bump;
+    m_arena.bump += size;
+
+#ifdef AUP_WIN32
+    while (m_arena.committed < m_arena.bump) {
+        if (VirtualAlloc(m_arena.committed, COMMIT_SIZE,
+            MEM_COMMIT, PAGE_READWRITE) == NULL) {
+            m_arena.bump = ptr;
+            return NULL;
+        }
+        m_arena.committed += COMMIT_SIZE;
+    }
+#endif
+
+    return ptr;
+}
+
+// The range only changes with the heap created or freed.
+bool aup_arenaOwns(const void *ptr)
+{
+    return (const char *)ptr >= m_arena.base &&
+           (const char *)ptr < m_arena.end;
+}
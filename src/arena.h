@@ -0,0 +1,17 @@
+#ifndef _AUP_ARENA_H
+#define _AUP_ARENA_H
+#pragma once
+
+#include "util.h"
+
+// One range of address space reserved up front, buffers are
+// bump allocated from it and only given back all at once.
+// Not thread safe, the heap lock guards the arena.
+bool aup_initArena(size_t size);
+void aup_freeArena();
+
+// Returns NULL once the range is used up.
+void *aup_arenaAlloc(size_t size);
+bool aup_arenaOwns(const void *ptr);
+
+#endif
@@ -39,4 +39,10 @@
 #define AUP_OSX
 #endif
 
+// The JIT stencils are x86-64 System V code built by GCC or Clang.
+#if defined(AUP_JIT) && !(defined(AUP_X64) && \
+    (defined(AUP_LINUX) || defined(AUP_OSX)) && defined(__GNUC__))
+#undef AUP_JIT
+#endif
+
 #endif
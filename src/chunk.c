@@ -131,7 +131,7 @@ int aup_dasmInst(aupChunk *chunk, int offset)
 #define CODE_ERR()  default:
 #define NEXT		break
 
-    printf("%-6s ", aup_opName(Op));
+    printf("%-8s ", aup_opName(Op));
     printf(" %2X %3X %3X ; ", A, Bx, Cx);
 
     DISPATCH
@@ -169,6 +169,11 @@ int aup_dasmInst(aupChunk *chunk, int offset)
             RA, PUT(" = "), RA, PUTF("(%d)", B);
             NEXT;
         }
+        CODE(TAILCALL)
+        {
+            PUT("return "), RA, PUTF("(%d)", B);
+            NEXT;
+        }
         CODE(RET)
         {
             A ? RKB : PUT("nil");
@@ -190,6 +195,26 @@ int aup_dasmInst(aupChunk *chunk, int offset)
             PUTF("-> %03d. if ", offset + Axx + 1), R(C), PUT(" != "), R(C - 1);
             NEXT;
         }
+        CODE(JLT)
+        CODE(JLT_NN)
+        {
+            PUTF("-> %03d. if %s(", offset + AUP_GetAxx(chunk->code[offset + 1]) + 2, A ? "" : "!"),
+                RKB, PUT(" < "), RKC, PUT(")");
+            NEXT;
+        }
+        CODE(JLE)
+        CODE(JLE_NN)
+        {
+            PUTF("-> %03d. if %s(", offset + AUP_GetAxx(chunk->code[offset + 1]) + 2, A ? "" : "!"),
+                RKB, PUT(" <= "), RKC, PUT(")");
+            NEXT;
+        }
+        CODE(JEQ)
+        {
+            PUTF("-> %03d. if %s(", offset + AUP_GetAxx(chunk->code[offset + 1]) + 2, A ? "" : "!"),
+                RKB, PUT(" == "), RKC, PUT(")");
+            NEXT;
+        }
 
         CODE(NOT)
         {
@@ -197,21 +222,25 @@ int aup_dasmInst(aupChunk *chunk, int offset)
             NEXT;
         }
         CODE(LT)
+        CODE(LT_NN)
         {
             RA, PUT(" = "), RKB, PUT(" < "), RKC;
             NEXT;
         }
         CODE(LE)
+        CODE(LE_NN)
         {
             RA, PUT(" = "), RKB, PUT(" <= "), RKC;
             NEXT;
         }
         CODE(GT)
+        CODE(GT_NN)
         {
             RA, PUT(" = "), RKB, PUT(" > "), RKC;
             NEXT;
         }
         CODE(GE)
+        CODE(GE_NN)
         {
             RA, PUT(" = "), RKB, PUT(" >= "), RKC;
             NEXT;
@@ -228,19 +257,23 @@ int aup_dasmInst(aupChunk *chunk, int offset)
             NEXT;
         }
         CODE(ADD)
+        CODE(ADD_NN)
         {
             RA, PUT(" = "), RKB, PUT(" + "), RKC;
             NEXT;
         }
-        CODE(SUB) {
+        CODE(SUB)
+        CODE(SUB_NN) {
             RA, PUT(" = "), RKB, PUT(" - "), RKC;
             NEXT;
         }
-        CODE(MUL) {
+        CODE(MUL)
+        CODE(MUL_NN) {
             RA, PUT(" = "), RKB, PUT(" * "), RKC;
             NEXT;
         }
-        CODE(DIV) {
+        CODE(DIV)
+        CODE(DIV_NN) {
             RA, PUT(" = "), RKB, PUT(" / "), RKC;
             NEXT;
         }
@@ -299,13 +332,12 @@ int aup_dasmInst(aupChunk *chunk, int offset)
 
         CODE(GLD)
         {
-            RA, PUT(" = G."), KB;
+            RA, PUTF(" = G[%d]", AUP_GetBxx(i));
             NEXT;
         }
         CODE(GST)
         {
-            PUT("G."), KA, PUT(" = ");
-            sC ? PUT("nil") : RKB;
+            PUTF("G[%d] = ", (uint16_t)Axx), RKC;
             NEXT;
         }
 
@@ -359,8 +391,8 @@ void aup_dasmChunk(aupChunk *chunk, const char *name)
         printf("\n");
     }
 
-    printf("off  ln col  op     A  Bx  Cx   comments           \n");
-    printf("--- --- --- ------------------ --------------------\n");
+    printf("off  ln col  op       A  Bx  Cx   comments           \n");
+    printf("--- --- --- -------------------- --------------------\n");
 
     for (int offset = 0; offset < chunk->count;) {
         offset = aup_dasmInst(chunk, offset);
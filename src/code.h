@@ -16,11 +16,15 @@
     _CODE(CLASS)    \
     \
     _CODE(CALL)     \
+    _CODE(TAILCALL) \
     _CODE(RET)      \
     \
     _CODE(JMP)      \
     _CODE(JMPF)     \
     _CODE(JNE)      \
+    _CODE(JLT)      \
+    _CODE(JLE)      \
+    _CODE(JEQ)      \
     \
     _CODE(NOT)      \
     _CODE(LT)       \
@@ -56,7 +60,18 @@
     _CODE(CLOSE)    \
     \
     _CODE(GET)      \
-    _CODE(SET)
+    _CODE(SET)      \
+    \
+    _CODE(LT_NN)    \
+    _CODE(LE_NN)    \
+    _CODE(GT_NN)    \
+    _CODE(GE_NN)    \
+    _CODE(JLT_NN)   \
+    _CODE(JLE_NN)   \
+    _CODE(ADD_NN)   \
+    _CODE(SUB_NN)   \
+    _CODE(MUL_NN)   \
+    _CODE(DIV_NN)
 
 #define _CODE(x) AUP_OP_##x,
 typedef enum { AUP_OPCODES() AUP_OPCOUNT } aupOp;
@@ -69,22 +84,23 @@ static const char *aup_opName(aupOp opcode) {
 #undef _CODE
 }
 
-#define AUP_OpA(Op, A)              ((uint32_t)((Op) | (((A) & 0xFF) << 6)))
-#define AUP_OpAB(Op, A, B)          ((uint32_t)((Op) | (((A) & 0xFF) << 6) | (((B)  & 0xFF)   << 14)))
-#define AUP_OpAC(Op, A, C)          ((uint32_t)((Op) | (((A) & 0xFF) << 6) | (((C)  & 0xFF)   << 23)))
-#define AUP_OpABC(Op, A, B, C)      ((uint32_t)((Op) | (((A) & 0xFF) << 6) | (((B)  & 0xFF)   << 14) | (((C)  & 0xFF)  << 23)))
-#define AUP_OpABx(Op, A, Bx)        ((uint32_t)((Op) | (((A) & 0xFF) << 6) | (((Bx) & 0x1FF)  << 14) ))
-#define AUP_OpACx(Op, A, Bx)        ((uint32_t)((Op) | (((A) & 0xFF) << 6) | (((Cx) & 0x1FF)  << 23) ))
-#define AUP_OpABxCx(Op, A, Bx, Cx)  ((uint32_t)((Op) | (((A) & 0xFF) << 6) | (((Bx) & 0x1FF)  << 14) | (((Cx) & 0x1FF) << 23)))
-#define AUP_OpAsB(Op, A, sB)        ((uint32_t)((Op) | (((A) & 0xFF) << 6) | (((sB) & 1)      << 22)))
-#define AUP_OpAsC(Op, A, sC)        ((uint32_t)((Op) | (((A) & 0xFF) << 6) | (((sC) & 1)      << 31)))
-#define AUP_OpAsBsC(Op, A, sB, sC)  ((uint32_t)((Op) | (((A) & 0xFF) << 6) | (((sB) & 1)      << 22) | (((sC) & 1)     << 31)))
-
-#define AUP_OpAxx(Op, Axx)          ((uint32_t)((Op) | ((uint16_t)(Axx) << 6)))
-#define AUP_OpAxxCx(Op, Axx, Cx)    ((uint32_t)((Op) | ((uint16_t)(Axx) << 6)                        | (((Cx) & 0x1FF) << 23)))
-#define AUP_OpABxx(Op, A, Bxx)      ((uint32_t)((Op) | (((A) & 0xFF) << 6) | ((uint16_t)(Bxx) << 14)))
+#define AUP_OpA(Op, A)              ((uint32_t)((Op) | (((uint32_t)(A) & 0xFF) << 6)))
+#define AUP_OpAB(Op, A, B)          ((uint32_t)((Op) | (((uint32_t)(A) & 0xFF) << 6) | (((uint32_t)(B) & 0xFF)   << 14)))
+#define AUP_OpAC(Op, A, C)          ((uint32_t)((Op) | (((uint32_t)(A) & 0xFF) << 6) | (((uint32_t)(C) & 0xFF)   << 23)))
+#define AUP_OpABC(Op, A, B, C)      ((uint32_t)((Op) | (((uint32_t)(A) & 0xFF) << 6) | (((uint32_t)(B) & 0xFF)   << 14) | (((uint32_t)(C) & 0xFF)  << 23)))
+#define AUP_OpABx(Op, A, Bx)        ((uint32_t)((Op) | (((uint32_t)(A) & 0xFF) << 6) | (((uint32_t)(Bx) & 0x1FF)  << 14) ))
+#define AUP_OpACx(Op, A, Cx)        ((uint32_t)((Op) | (((uint32_t)(A) & 0xFF) << 6) | (((uint32_t)(Cx) & 0x1FF)  << 23) ))
+#define AUP_OpABxCx(Op, A, Bx, Cx)  ((uint32_t)((Op) | (((uint32_t)(A) & 0xFF) << 6) | (((uint32_t)(Bx) & 0x1FF)  << 14) | (((uint32_t)(Cx) & 0x1FF) << 23)))
+#define AUP_OpAsB(Op, A, sB)        ((uint32_t)((Op) | (((uint32_t)(A) & 0xFF) << 6) | (((uint32_t)(sB) & 1)      << 22)))
+#define AUP_OpAsC(Op, A, sC)        ((uint32_t)((Op) | (((uint32_t)(A) & 0xFF) << 6) | (((uint32_t)(sC) & 1)      << 31)))
+#define AUP_OpAsBsC(Op, A, sB, sC)  ((uint32_t)((Op) | (((uint32_t)(A) & 0xFF) << 6) | (((uint32_t)(sB) & 1)      << 22) | (((uint32_t)(sC) & 1)     << 31)))
+
+#define AUP_OpAxx(Op, Axx)          ((uint32_t)((Op) | ((uint32_t)(uint16_t)(Axx) << 6)))
+#define AUP_OpAxxCx(Op, Axx, Cx)    ((uint32_t)((Op) | ((uint32_t)(uint16_t)(Axx) << 6)                        | (((uint32_t)(Cx) & 0x1FF) << 23)))
+#define AUP_OpABxx(Op, A, Bxx)      ((uint32_t)((Op) | (((uint32_t)(A) & 0xFF) << 6) | ((uint32_t)(uint16_t)(Bxx) << 14)))
 
 #define AUP_GetOp(i)                ((aupOp)   ( (i) &  0x3F       ))
+#define AUP_SetOp(i, Op)            ((uint32_t)(((i) & ~0x3F) | (Op)   ))
 #define AUP_GetA(i)                 ((uint8_t) ( (i) >> 6          ))
 #define AUP_GetB(i)                 ((uint8_t) ( (i) >> 14         ))
 #define AUP_GetC(i)                 ((uint8_t) ( (i) >> 23         ))
@@ -1,49 +1,414 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <stddef.h>
+#include <math.h>
 
 #include "gc.h"
 #include "vm.h"
+#include "slab.h"
+#include "arena.h"
+#include "thread.h"
+
+volatile int aup_stopRequest;
+volatile int aup_gcMarking;
+
+// A stack of gray objects, one for every thread taking part
+// in a mark.
+typedef struct {
+    aupObj **items;
+    int      count;
+    int      space;
+    uint64_t blackened;     // objects traced by major cycles
+} Gray;
+
+// Allocation buffer of a thread in the heap. Objects come from
+// slab pages it owns, without the heap lock, and are handed to
+// the collector when it stops the world or the thread leaves.
+typedef struct _TLAB {
+    aupSlabCache cache;
+    aupObj *young;          // allocated since the last flush
+    aupObj *youngTail;
+    bool    old;            // the heap was an arena at the refill
+    size_t  allocated;      // bytes not reported to the pacer yet
+    size_t  objects;
+    struct _TLAB *next;
+    struct _TLAB *prev;
+} TLAB;
+
+typedef enum {
+    GC_IDLE,
+    GC_MARK,
+    GC_SWEEP
+} GCPhase;
 
 static struct {
-    size_t nextGC;
-    size_t allocated;
-    aupObj *objects;
-    aupObj **grayStack;
-    int    grayCount;
-    int    graySpace;
+    volatile size_t nextGC;
+    volatile size_t allocated;
+    volatile size_t youngAllocated;     // since the last collection
+    volatile bool arena;    // nothing collected until arenaLimit
+    size_t arenaLimit;
+    aupObj *young;          // allocated since the last collection
+    TLAB   *tlabs;          // of the threads in the heap
+    aupObj **remembered;    // old objects that may point to young ones
+    int    rememberedCount;
+    int    rememberedSpace;
+    bool   minor;
+
+    // Incremental major cycle
+    volatile GCPhase phase;
+    size_t objectCount;
+    double workPerByte;     // pacer, set when a cycle starts
+    double workDebt;        // units owed by the next slice
+    uint64_t pauseNs;       // target length of one slice
+    aupGCStats stats;
+
+    // Pacer, see nextThreshold
+    double growth;
+    size_t heapMin;
+    size_t heapMax;         // 0 for none
+    size_t softLimit;       // 0 for none
+    size_t live;            // bytes left by the last cycle
+
+    // Telemetry
+    uint64_t pauseStart;
+    uint64_t freed;         // object bytes, since the last collection
+
+    // Marker thread, traces while the mutators run
+    bool     concurrent;
+    bool     markerStarted;
+    bool     markerStop;
+    aupThread marker;
+    aupCond  markWake;      // a cycle started or the heap goes away
+
+    Gray   gray;
+    bool   parallel;        // GC threads are marking with this one
+
+    // Compaction, run from a safepoint once a cycle left enough
+    // sparse pages behind
+    bool   compact;
+    int    stress;          // AUP_GC_STRESS_*
+    bool   compactPending;
     aupTab strings;
-    aupTab globals;
+    aupTab globals;         // name -> slot index
+    aupArr globalValues;    // slot index -> value
+    long   globalLock;      // guards tagged values, see aup_loadGlobal
     aupVM  *root;
+
+    // Stop-the-world state, guarded by the heap lock.
+    aupMutex lock;
+    aupCond  parked;        // a mutator parked or left
+    aupCond  resume;        // the collection is over
+    int      mutators;
+    int      parkedCount;
+    int      safeCount;     // of those, parked at a safepoint
+    bool     stopping;
 } m_gc;
 
-void aup_initGC()
+static THREAD_LOCAL bool t_mutator;
+static THREAD_LOCAL TLAB t_tlab;
+
+#ifdef AUP_CHECKMAPS
+aupObj aup_deadValue;
+
+// Live registers of the VM being poisoned, see poisonDeadSlots.
+static aupVal  *m_slotBase;
+static uint8_t *m_slotLive;
+static size_t   m_slotSpace;
+#endif
+
+// Objects handed from one GC thread to another at a time.
+#define CHUNK_SIZE      64
+
+typedef struct _Chunk {
+    struct _Chunk *next;
+    aupObj *items[CHUNK_SIZE];
+} Chunk;
+
+typedef struct {
+    Gray     gray;
+    unsigned round;         // last drain taken part in
+} Helper;
+
+// GC threads draining the gray stack along with the collecting
+// one while the world is stopped. Each traces from a stack of
+// its own, and moves a chunk of it to the pool whenever another
+// one runs dry.
+static struct {
+    aupMutex  lock;
+    aupCond   start;        // a drain began, or stopping
+    aupCond   work;         // a chunk was pooled, or the drain is over
+    aupCond   done;         // a helper left the drain
+    Chunk    *pool;
+    Chunk    *spare;
+    volatile int idle;      // threads waiting for a chunk
+    int       active;       // threads in the drain
+    int       running;      // helpers not done with it yet
+    unsigned  round;
+    bool      finished;
+    bool      stopping;
+
+    int       threadCount;  // wanted, the collecting thread included
+    int       helperCount;  // started
+    aupThread *threads;
+    Helper   *helpers;
+} m_mark;
+
+// Called by the slabs for every object they sweep.
+static void finalize(void *object)
 {
+    size_t size = aup_releaseObject((aupObj *)object);
+    AUP_AtomicAdd(&m_gc.allocated, -size);
+    m_gc.freed += size;
+    m_gc.objectCount--;
+}
+
+// With [arenaLimit] set the heap starts as an arena, see
+// aup_createArenaVM.
+void aup_initGC(size_t arenaLimit)
+{
+    aup_initHash();
+
     m_gc.allocated = 0;
-    m_gc.nextGC = 1024 * 1024;
+    m_gc.growth = AUP_GC_GROWTH;
+    m_gc.heapMin = AUP_GC_HEAP_MIN;
+    m_gc.heapMax = 0;
+    m_gc.softLimit = 0;
+    m_gc.live = 0;
+    m_gc.nextGC = AUP_GC_HEAP_MIN;
+    m_gc.freed = 0;
+    m_gc.arena = (arenaLimit > 0) && aup_initArena(arenaLimit);
+    m_gc.arenaLimit = arenaLimit;
 
-    m_gc.grayCount = 0;
-    m_gc.graySpace = 0;
-    m_gc.grayStack = NULL;
-    m_gc.objects = NULL;
+    aup_initMutex(&m_gc.lock);
+    aup_initCond(&m_gc.parked);
+    aup_initCond(&m_gc.resume);
+    m_gc.mutators = 0;
+    m_gc.parkedCount = 0;
+    m_gc.safeCount = 0;
+    m_gc.stopping = false;
 
+    memset(&m_gc.gray, '\0', sizeof(Gray));
+    m_gc.parallel = false;
+    m_gc.compact = true;
+    m_gc.compactPending = false;
+    m_gc.stress = AUP_GC_STRESS_OFF;
+    m_gc.young = NULL;
+    m_gc.tlabs = NULL;
+    m_gc.youngAllocated = 0;
+    m_gc.remembered = NULL;
+    m_gc.rememberedCount = 0;
+    m_gc.rememberedSpace = 0;
+
+    m_gc.phase = GC_IDLE;
+    m_gc.objectCount = 0;
+    m_gc.workDebt = 0;
+    m_gc.pauseNs = AUP_GC_PAUSE * 1000;
+    memset(&m_gc.stats, '\0', sizeof(aupGCStats));
+    aup_gcMarking = false;
+
+    // Tracing off-thread only pays with a core to spare.
+    m_gc.concurrent = (aup_cpuCount() > 1);
+    m_gc.markerStarted = false;
+    m_gc.markerStop = false;
+    aup_initCond(&m_gc.markWake);
+
+    memset(&m_mark, '\0', sizeof(m_mark));
+    aup_initMutex(&m_mark.lock);
+    aup_initCond(&m_mark.start);
+    aup_initCond(&m_mark.work);
+    aup_initCond(&m_mark.done);
+    m_mark.threadCount = aup_cpuCount();
+    if (m_mark.threadCount > AUP_GC_THREADS) m_mark.threadCount = AUP_GC_THREADS;
+
+    aup_initSlabs(finalize);
     aup_initTable(&m_gc.strings);
     aup_initTable(&m_gc.globals);
+    aup_initArray(&m_gc.globalValues);
+
+    // Slots are 16-bit, reserve all of them up front so running
+    // code can keep a pointer to the values while new globals
+    // are defined.
+    m_gc.globalValues.space = UINT16_COUNT;
+    m_gc.globalValues.values = malloc(sizeof(aupVal) * UINT16_COUNT);
+    m_gc.globalLock = 0;
 }
 
+static void stopHelpers();
+
 void aup_freeGC()
 {
-    aupObj *object = m_gc.objects;
+    if (m_gc.markerStarted) {
+        aup_lock(&m_gc.lock);
+        m_gc.markerStop = true;
+        aup_broadcast(&m_gc.markWake);
+        aup_unlock(&m_gc.lock);
+        aup_joinThread(m_gc.marker);
+    }
 
-    while (object != NULL) {
-        aupObj *next = (aupObj *)object->next;
-        aup_freeObject(object);
-        object = next;
+    stopHelpers();
+    while (m_mark.spare != NULL) {
+        Chunk *chunk = m_mark.spare;
+        m_mark.spare = chunk->next;
+        free(chunk);
     }
 
-    free(m_gc.grayStack);
+    aup_freeSlabs();
+    aup_freeArena();
+
+    free(m_gc.gray.items);
+    free(m_gc.remembered);
+#ifdef AUP_CHECKMAPS
+    free(m_slotLive);
+    m_slotLive = NULL;
+    m_slotSpace = 0;
+#endif
+    aup_freeArray(&m_gc.globalValues);
     aup_freeTable(&m_gc.globals);
     aup_freeTable(&m_gc.strings);
+
+    aup_freeCond(&m_mark.done);
+    aup_freeCond(&m_mark.work);
+    aup_freeCond(&m_mark.start);
+    aup_freeMutex(&m_mark.lock);
+    aup_freeCond(&m_gc.markWake);
+    aup_freeCond(&m_gc.resume);
+    aup_freeCond(&m_gc.parked);
+    aup_freeMutex(&m_gc.lock);
+}
+
+// Mutators park here while a collection is pending, so the
+// lock is only handed back with the world running.
+static void lockHeap(bool safe)
+{
+    aup_lock(&m_gc.lock);
+
+    while (m_gc.stopping && t_mutator) {
+        m_gc.parkedCount++;
+        if (safe) m_gc.safeCount++;
+        aup_signal(&m_gc.parked);
+        aup_wait(&m_gc.resume, &m_gc.lock);
+        if (safe) m_gc.safeCount--;
+        m_gc.parkedCount--;
+    }
+}
+
+void aup_lockHeap()
+{
+    lockHeap(false);
+}
+
+void aup_unlockHeap()
+{
+    aup_unlock(&m_gc.lock);
+}
+
+// Tells the pacer of what [tlab] allocated on its own. Called
+// with the heap lock held.
+static void report(TLAB *tlab)
+{
+    if (tlab->objects == 0) return;
+
+    AUP_AtomicAdd(&m_gc.allocated, tlab->allocated);
+    if (!m_gc.arena) AUP_AtomicAdd(&m_gc.youngAllocated, tlab->allocated);
+    m_gc.objectCount += tlab->objects;
+
+    tlab->allocated = 0;
+    tlab->objects = 0;
+}
+
+// Gives back the pages of [tlab] and moves its objects to the
+// young list, called with the heap lock held.
+static void flushTLAB(TLAB *tlab)
+{
+    aup_slabFlush(&tlab->cache);
+
+    if (tlab->young != NULL) {
+        tlab->youngTail->next = (uintptr_t)m_gc.young;
+        m_gc.young = tlab->young;
+        tlab->young = tlab->youngTail = NULL;
+    }
+
+    report(tlab);
+}
+
+// A thread must enter the heap before running script code,
+// and leave it before blocking on anything but the heap.
+void aup_enterHeap()
+{
+    aup_lock(&m_gc.lock);
+    while (m_gc.stopping) {
+        aup_wait(&m_gc.resume, &m_gc.lock);
+    }
+    m_gc.mutators++;
+    t_mutator = true;
+
+    t_tlab.prev = NULL;
+    t_tlab.next = m_gc.tlabs;
+    if (m_gc.tlabs != NULL) m_gc.tlabs->prev = &t_tlab;
+    m_gc.tlabs = &t_tlab;
+    aup_unlock(&m_gc.lock);
+}
+
+void aup_leaveHeap()
+{
+    aup_lock(&m_gc.lock);
+    flushTLAB(&t_tlab);
+    if (t_tlab.prev != NULL)
+        t_tlab.prev->next = t_tlab.next;
+    else
+        m_gc.tlabs = t_tlab.next;
+    if (t_tlab.next != NULL) t_tlab.next->prev = t_tlab.prev;
+
+    m_gc.mutators--;
+    t_mutator = false;
+    aup_signal(&m_gc.parked);
+    aup_unlock(&m_gc.lock);
+}
+
+static void compact();
+
+// Called by running VMs with their frames stored, the thread
+// holds no object in C locals here.
+void aup_safepoint()
+{
+    lockHeap(true);
+    if (m_gc.compactPending) compact();
+    aup_unlockHeap();
+}
+
+// VMs sharing the heap form a ring, every one of them
+// contributes roots to a collection.
+void aup_attachVM(aupVM *vm, aupVM *from)
+{
+    aup_lockHeap();
+    if (from == NULL) {
+        vm->next = vm->prev = vm;
+        m_gc.root = vm;
+    }
+    else {
+        vm->prev = from;
+        vm->next = from->next;
+        from->next->prev = vm;
+        from->next = vm;
+    }
+    aup_unlockHeap();
+}
+
+// Returns true if [vm] was the last one on the heap.
+bool aup_detachVM(aupVM *vm)
+{
+    aup_lockHeap();
+    bool last = (vm->next == vm);
+    if (m_gc.root == vm) {
+        m_gc.root = (vm->next != vm) ? vm->next : NULL;
+    }
+
+    vm->prev->next = vm->next;
+    vm->next->prev = vm->prev;
+    vm->next = vm->prev = vm;
+    aup_unlockHeap();
+    return last;
 }
 
 aupTab *aup_getStrings()
@@ -56,12 +421,169 @@ aupTab *aup_getGlobals()
     return &m_gc.globals;
 }
 
+aupArr *aup_getGlobalValues()
+{
+    return &m_gc.globalValues;
+}
+
+static int globalSlot(aupStr *name)
+{
+    aupVal index;
+    if (aup_getKey(&m_gc.globals, name, &index)) {
+        return AUP_AsInt(index);
+    }
+
+    if (m_gc.globalValues.count == UINT16_COUNT) {
+        return -1;
+    }
+
+    int slot = aup_pushArray(&m_gc.globalValues, AUP_VNil, true);
+    aup_setKey(&m_gc.globals, name, AUP_VNum(slot));
+    return slot;
+}
+
+int aup_globalSlot(aupStr *name)
+{
+    aup_lockHeap();
+    int slot = globalSlot(name);
+    aup_unlockHeap();
+    return slot;
+}
+
+bool aup_getGlobal(aupStr *name, aupVal *value)
+{
+    aupVal index;
+    aup_lockHeap();
+
+    bool found = aup_getKey(&m_gc.globals, name, &index);
+    *value = found ? aup_loadGlobal(&m_gc.globalValues.values[AUP_AsInt(index)])
+                   : AUP_VNil;
+
+    aup_unlockHeap();
+    return found;
+}
+
+void aup_setGlobal(aupStr *name, aupVal value)
+{
+    aup_lockHeap();
+
+    int slot = globalSlot(name);
+    if (slot >= 0) {
+        aup_storeGlobal(&m_gc.globalValues.values[slot], value);
+    }
+
+    aup_unlockHeap();
+}
+
+#ifndef AUP_NAN_BOXING
+static void lockGlobals()
+{
+    while (!AUP_AtomicCAS(&m_gc.globalLock, 0, 1)) {
+        aup_yieldThread();
+    }
+}
+
+static void unlockGlobals()
+{
+    AUP_AtomicStore(&m_gc.globalLock, 0);
+}
+
+aupVal aup_loadGlobal(aupVal *slot)
+{
+    lockGlobals();
+    aupVal value = *slot;
+    unlockGlobals();
+    return value;
+}
+
+void aup_storeGlobal(aupVal *slot, aupVal value)
+{
+    lockGlobals();
+    *slot = value;
+    unlockGlobals();
+}
+#endif
+
+static void step();
+static void startCycle();
+static void minorCollect();
+static void collectFull();
+
+// The collection aup_setGCStress asked for, at every allocation.
+static void stressGC()
+{
+    aup_lockHeap();
+    if (m_gc.stress == AUP_GC_STRESS_MINOR) {
+        if (m_gc.phase != GC_IDLE) step();
+        else minorCollect();
+    }
+    else if (m_gc.stress != AUP_GC_STRESS_OFF) {
+        collectFull();
+    }
+    aup_unlockHeap();
+}
+
+// Only the thread crossing a threshold collects, the others
+// park at the heap lock meanwhile. While a major cycle runs,
+// youngAllocated is the allocation debt of its next slice.
+static void checkGC()
+{
+    if (AUP_AtomicLoad(&m_gc.stress) != AUP_GC_STRESS_OFF) {
+        stressGC();
+        return;
+    }
+
+    size_t limit = (AUP_AtomicLoad(&m_gc.phase) == GC_IDLE) ?
+        AUP_NURSERY_SIZE : AUP_GC_STEP;
+
+    if (AUP_AtomicLoad(&m_gc.youngAllocated) > limit ||
+        AUP_AtomicLoad(&m_gc.allocated) > AUP_AtomicLoad(&m_gc.nextGC)) {
+        aup_lockHeap();
+        size_t young = AUP_AtomicLoad(&m_gc.youngAllocated);
+        if (m_gc.phase != GC_IDLE) {
+            if (young > AUP_GC_STEP) step();
+        }
+        else if (AUP_AtomicLoad(&m_gc.allocated) > m_gc.nextGC) {
+            startCycle();
+        }
+        else if (young > AUP_NURSERY_SIZE) {
+            minorCollect();
+        }
+        aup_unlockHeap();
+    }
+}
+
+// Past its ceiling an arena heap collects like any other,
+// what it allocated so far is old.
+static void leaveArena()
+{
+    aup_lockHeap();
+    m_gc.arena = false;
+    aup_unlockHeap();
+}
+
+static void account(size_t size)
+{
+    AUP_AtomicAdd(&m_gc.allocated, size);
+
+    if (AUP_AtomicLoad(&m_gc.arena)) {
+        if (AUP_AtomicLoad(&m_gc.allocated) > m_gc.arenaLimit) leaveArena();
+        return;
+    }
+
+    AUP_AtomicAdd(&m_gc.youngAllocated, size);
+    checkGC();
+}
+
 void *aup_alloc(size_t size)
 {
-    m_gc.allocated += size;
+    account(size);
 
-    if (m_gc.allocated > m_gc.nextGC) {
-        aup_collect();
+    if (AUP_AtomicLoad(&m_gc.arena)) {
+        aup_lockHeap();
+        void *ptr = aup_arenaAlloc(size);
+        aup_unlockHeap();
+        if (ptr != NULL) return ptr;
     }
 
     return malloc(size);
@@ -69,10 +591,21 @@ void *aup_alloc(size_t size)
 
 void *aup_realloc(void *ptr, size_t old, size_t _new)
 {
-    m_gc.allocated += _new - old;
+    // Arena buffers are copied out, never resized or freed.
+    if (ptr != NULL && aup_arenaOwns(ptr)) {
+        AUP_AtomicAdd(&m_gc.allocated, -old);
+        if (_new == 0) return NULL;
+
+        void *moved = aup_alloc(_new);
+        memcpy(moved, ptr, (old < _new) ? old : _new);
+        return moved;
+    }
 
-    if (_new > old && m_gc.allocated > m_gc.nextGC) {
-        aup_collect();
+    AUP_AtomicAdd(&m_gc.allocated, _new - old);
+
+    if (_new > old && !AUP_AtomicLoad(&m_gc.arena)) {
+        AUP_AtomicAdd(&m_gc.youngAllocated, _new - old);
+        checkGC();
     }
 
     if (_new == 0) {
@@ -85,192 +618,1395 @@ void *aup_realloc(void *ptr, size_t old, size_t _new)
 
 void aup_dealloc(void *ptr, size_t size)
 {
-    m_gc.allocated -= size;
-    free(ptr);
+    AUP_AtomicAdd(&m_gc.allocated, -size);
+    if (!aup_arenaOwns(ptr)) free(ptr);
 }
 
-void *aup_allocObject(size_t size, aupTObj type)
+static void *initObject(aupObj *object, aupTObj type, TLAB *tlab)
 {
-    aupObj *object = aup_alloc(size);
     object->type = type;
-    object->isMarked = false;
+    object->isOld = tlab->old;
+    object->isRemembered = false;
 
-    object->next = (uintptr_t)m_gc.objects;
-    m_gc.objects = object;
+    if (!tlab->old) {
+        object->next = (uintptr_t)tlab->young;
+        if (tlab->young == NULL) tlab->youngTail = object;
+        tlab->young = object;
+    }
     return object;
 }
 
-static void markObject(aupObj *object)
+// Refills the thread's buffer, or carves the object from slab
+// pages under the heap lock: for large objects, threads outside
+// the heap and while a cycle marks.
+static void *allocSlow(size_t size, aupTObj type)
 {
-    if (object == NULL) return;
-    if (object->isMarked) return;
-    object->isMarked = true;
+    TLAB *tlab = t_mutator ? &t_tlab : NULL;
 
-    if (m_gc.graySpace <= m_gc.grayCount) {
-        m_gc.graySpace = AUP_GROW(m_gc.graySpace);
-        m_gc.grayStack = realloc(m_gc.grayStack,
-            sizeof(aupObj *) * m_gc.graySpace);
+    if (tlab != NULL && tlab->objects > 0) {
+        aup_lockHeap();
+        report(tlab);
+        aup_unlockHeap();
+    }
+    account(size);
+
+    aup_lockHeap();
+    m_gc.objectCount++;
+
+    if (tlab != NULL && m_gc.phase != GC_MARK &&
+        aup_slabRefill(&tlab->cache, size))
+    {
+        tlab->old = m_gc.arena;
+        aupObj *object = aup_slabCacheAlloc(&tlab->cache, size);
+        aup_unlockHeap();
+        return initObject(object, type, tlab);
     }
 
-    m_gc.grayStack[m_gc.grayCount++] = object;
+    aupObj *object = aup_slabAlloc(size);
+    object->type = type;
+    object->isOld = false;
+    object->isRemembered = false;
+
+    if (m_gc.arena) {
+        // Never linked, an arena heap collects nothing.
+        object->isOld = true;
+    }
+    else if (m_gc.phase == GC_MARK) {
+        // A marking cycle runs no minor collections, new objects
+        // go old and black.
+        object->isOld = true;
+        aup_slabMark(object);
+    }
+    else {
+        object->next = (uintptr_t)m_gc.young;
+        m_gc.young = object;
+    }
+    aup_unlockHeap();
+    return object;
 }
 
-static void markValue(aupVal value)
+// Objects are carved from slab pages, the old generation is
+// only known by its pages. The pacer hears of small objects
+// once their page is used up, or of every one under stress.
+void *aup_allocObject(size_t size, aupTObj type)
 {
-    if (!AUP_IsObj(value)) return;
-    markObject(AUP_AsObj(value));
+    if (t_mutator && AUP_AtomicLoad(&m_gc.stress) == AUP_GC_STRESS_OFF) {
+        aupObj *object = aup_slabCacheAlloc(&t_tlab.cache, size);
+        if (object != NULL) {
+            t_tlab.allocated += size;
+            t_tlab.objects++;
+            return initObject(object, type, &t_tlab);
+        }
+    }
+
+    return allocSlow(size, type);
 }
 
-static void markArray(aupArr *array)
+// Objects are only freed by the collector, with the heap lock
+// held or once the heap is gone.
+void aup_deallocObject(void *object, size_t size)
 {
-    for (int i = 0; i < array->count; i++) {
-        markValue(array->values[i]);
+    AUP_AtomicAdd(&m_gc.allocated, -size);
+    aup_slabFree(object);
+}
+
+// Slow path of AUP_WriteBarrier, [object] is old and was
+// given a young value.
+void aup_remember(aupObj *object)
+{
+    aup_lockHeap();
+
+    if (!object->isRemembered) {
+        object->isRemembered = true;
+
+        if (m_gc.rememberedSpace <= m_gc.rememberedCount) {
+            m_gc.rememberedSpace = AUP_GROW(m_gc.rememberedSpace);
+            m_gc.remembered = realloc(m_gc.remembered,
+                sizeof(aupObj *) * m_gc.rememberedSpace);
+        }
+
+        m_gc.remembered[m_gc.rememberedCount++] = object;
     }
+
+    aup_unlockHeap();
 }
 
-static void markTable(aupTab *table)
+static void markObject(Gray *gray, aupObj *object);
+static void markValue(Gray *gray, aupVal value);
+
+// Keeps [object] alive through a marking cycle, for weak
+// references handed out again. Called with the heap lock held.
+void aup_shade(aupObj *object)
 {
-    for (int i = 0; i <= table->capMask; i++) {
-        aupEnt *entry = &table->entries[i];
-        markObject((aupObj *)entry->key);
-        markValue(entry->value);
+    if (aup_gcMarking) {
+        markObject(&m_gc.gray, object);
     }
 }
 
-void aup_collect()
+// Slow paths of AUP_SetValue and AUP_SetObject.
+void aup_storeValue(aupObj *owner, aupVal *slot, aupVal value)
 {
-    aupTab *strings = &m_gc.strings;
-    aupTab *globals = &m_gc.globals;
+    aup_lockHeap();
+    if (aup_gcMarking) {
+        markValue(&m_gc.gray, *slot);
+    }
+    *slot = value;
+    aup_unlockHeap();
 
-    /* === Suspend all threads === */
-    /*
-    for (aupVM *next = vm->next;
-        next != vm;
-        next = next->next)
-    {
-        // TODO
+    AUP_WriteBarrier(owner, value);
+}
+
+void aup_storeObject(aupObj *owner, aupObj **slot, aupObj *value)
+{
+    aup_lockHeap();
+    if (aup_gcMarking) {
+        markObject(&m_gc.gray, *slot);
     }
-    */
+    *slot = value;
+    aup_unlockHeap();
 
-    /* === Mark roots === */
-    for (aupVM *vm = m_gc.root;
-        vm != NULL;
-        vm = vm->next)
-    {
-        // Mark temp objects
-        for (int i = 0; i < vm->numRoots; i++)
-        {
-            markObject(vm->tempRoots[i]);
-        }
+    if (value != NULL) AUP_WriteBarrier(owner, AUP_VObj(value));
+}
 
-        // Mark stack
-        aupVal *top = vm->top +
-            vm->frames[vm->frameCount - 1].function->locals;
-        for (aupVal *slot = vm->stack; slot < top; slot++)
-        {
-            markValue(*slot);
-        }
+static void pushGray(Gray *gray, aupObj *object)
+{
+    if (gray->space <= gray->count) {
+        gray->space = AUP_GROW(gray->space);
+        gray->items = realloc(gray->items, sizeof(aupObj *) * gray->space);
+    }
 
-        // Mark call frames
-        for (int i = 0; i < vm->frameCount; i++)
-        {
-            markObject((aupObj *)vm->frames[i].function);
-        }
+    gray->items[gray->count++] = object;
+}
 
-        // Mark upvalues
-        for (aupUpv *upvalue = vm->openUpvals;
-            upvalue != NULL;
-            upvalue = upvalue->next)
-        {
-            markObject((aupObj *)upvalue);
-        }
+static void markObject(Gray *gray, aupObj *object)
+{
+    if (object == NULL) return;
+#ifdef AUP_CHECKMAPS
+    if (object == &aup_deadValue) {
+        fprintf(stderr, "A register the stack map calls dead reached the heap.\n");
+        abort();
     }
+#endif
+    // A minor collection takes the old generation as live, its
+    // references into the young one come from the remembered set.
+    if (object->isOld && m_gc.minor) return;
+    if (!(m_gc.parallel ? aup_slabMarkAtomic(object) : aup_slabMark(object))) return;
 
-    markTable(globals);
-    //markCompilerRoots(vm);
+    pushGray(gray, object);
+}
 
-    /* === Trace references === */
-    while (m_gc.grayCount > 0)
-    {
-        aupObj *object = m_gc.grayStack[--m_gc.grayCount];
-        switch (object->type) {
-            case AUP_OSTR:
-                break;
-            case AUP_OUPV: {
-                markValue(((aupUpv *)object)->closed);
-                break;
-            }
-            case AUP_OFUN: {
-                aupFun *function = (aupFun *)object;
-                markObject((aupObj *)function->name);
-                markArray(&function->chunk.constants);
-                for (int i = 0; i < function->upvalCount; i++) {
-                    markObject((aupObj *)function->upvals[i]);
-                }
-                break;
-            }
-            case AUP_OKLS: {
-                aupKls *klass = (aupKls *)object;
-                markObject((aupObj *)klass->name);
-                break;
-            }
-            case AUP_OINC: {
-                aupInc *instance = (aupInc *)object;
-                markObject((aupObj *)instance->klass);
-                markTable(&instance->fields);
-                break;
-            }
-        }
+static void markValue(Gray *gray, aupVal value)
+{
+    if (!AUP_IsObj(value)) return;
+    markObject(gray, AUP_AsObj(value));
+}
+
+static void markArray(Gray *gray, aupArr *array)
+{
+    for (int i = 0; i < array->count; i++) {
+        markValue(gray, array->values[i]);
     }
+}
 
-    /* === Remove unreferenced strings === */
-    for (int i = 0; i <= strings->capMask; i++)
-    {
-        aupStr *key = strings->entries[i].key;      
-        if (key != NULL && !key->base.isMarked)
-        {
-            aup_removeKey(strings, key);
+static void markTable(Gray *gray, aupTab *table)
+{
+    for (int i = 0; i <= table->capMask; i++) {
+        aupEnt *entry = &table->entries[i];
+        markObject(gray, (aupObj *)entry->key);
+        markValue(gray, entry->value);
+    }
+}
+
+static void blackenObject(Gray *gray, aupObj *object)
+{
+    if (!m_gc.minor) gray->blackened++;
+
+    switch (object->type) {
+        case AUP_OSTR:
+            break;
+        case AUP_OUPV: {
+            markValue(gray, ((aupUpv *)object)->closed);
+            break;
+        }
+        case AUP_OFUN: {
+            aupFun *function = (aupFun *)object;
+            markObject(gray, (aupObj *)function->name);
+            markArray(gray, &function->chunk.constants);
+            // The upvalue array is made by the first OPEN
+            if (function->upvals == NULL) break;
+            for (int i = 0; i < function->upvalCount; i++) {
+                markObject(gray, (aupObj *)function->upvals[i]);
+            }
+            break;
+        }
+        case AUP_OKLS: {
+            aupKls *klass = (aupKls *)object;
+            markObject(gray, (aupObj *)klass->name);
+            break;
+        }
+        case AUP_OINC: {
+            aupInc *instance = (aupInc *)object;
+            markObject(gray, (aupObj *)instance->klass);
+            markTable(gray, &instance->fields);
+            break;
+        }
+        case AUP_ONAT: {
+            markObject(gray, (aupObj *)((aupNat *)object)->name);
+            break;
+        }
+        case AUP_OTSK: {
+            markValue(gray, ((aupTsk *)object)->result);
+            break;
+        }
+        case AUP_OROP: {
+            aupRop *rope = (aupRop *)object;
+            markObject(gray, (aupObj *)rope->owner);
+            markObject(gray, (aupObj *)rope->flat);
+            break;
         }
     }
+}
 
-    /* === Sweep === */
-    for (aupObj *previous = NULL,
-                *object = m_gc.objects;
-        object != NULL;)
+// Frees the unmarked objects of [list], survivors are unmarked
+// and moved to the old generation.
+static void sweepYoung(aupObj **list)
+{
+    aupTab *strings = &m_gc.strings;
+
+    for (aupObj *object = *list; object != NULL;)
     {
-        if (object->isMarked)
+        aupObj *next = (aupObj *)object->next;
+
+        if (aup_slabIsMarked(object))
         {
-            object->isMarked = false;
-            previous = object;
-            object = (aupObj *)object->next;
+            aup_slabUnmark(object);
+            object->isOld = true;
         }
         else
         {
-            aupObj *unreached = object;
-            object = (aupObj *)object->next;
-
-            if (previous != NULL)
+            // Dead young strings leave the table one by one, the
+            // whole table is only pruned by a major cycle.
+            if (object->type == AUP_OSTR && m_gc.minor)
             {
-                previous->next = (uintptr_t)object;
-            }
-            else
-            {
-                m_gc.objects = object;
+                aup_removeKey(strings, (aupStr *)object);
             }
 
-            aup_freeObject(unreached);
+            size_t size = aup_releaseObject(object);
+            aup_deallocObject(object, size);
+            m_gc.freed += size;
+            m_gc.objectCount--;
         }
+
+        object = next;
     }
 
-    m_gc.nextGC = m_gc.allocated * 2;
+    *list = NULL;
+}
+
+static void stopWorld()
+{
+    // Every other mutator parks at its next safepoint or at the
+    // heap lock, with its frames stored.
+    m_gc.stopping = true;
+    m_gc.pauseStart = aup_nanoTime();
+    AUP_AtomicStore(&aup_stopRequest, 1);
 
-    /* === Resume all threads === */
-    /*
-    for (aupVM *next = vm->next;
-        next != vm;
-        next = next->next)
+    while (m_gc.parkedCount < m_gc.mutators - (t_mutator ? 1 : 0))
     {
-        // TODO
+        aup_wait(&m_gc.parked, &m_gc.lock);
     }
-    */
+
+    // The collector sees every page and young object.
+    for (TLAB *tlab = m_gc.tlabs; tlab != NULL; tlab = tlab->next)
+    {
+        flushTLAB(tlab);
+    }
+}
+
+// Histogram bucket of [value], its log2.
+static int bucketOf(uint64_t value)
+{
+    int bucket = 0;
+    while (value > 1 && bucket < AUP_GC_BUCKETS - 1)
+    {
+        value >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+// Telemetry of a finished collection, minor or major.
+static void recordCollection()
+{
+    m_gc.stats.freed += m_gc.freed;
+    m_gc.stats.heap = m_gc.allocated;
+    m_gc.stats.freedHist[bucketOf(m_gc.freed / 1024)]++;
+    m_gc.stats.heapHist[bucketOf(m_gc.allocated / 1024)]++;
+    m_gc.freed = 0;
+}
+
+static void resumeWorld()
+{
+    uint64_t pause = aup_nanoTime() - m_gc.pauseStart;
+    m_gc.stats.pauseTotal += pause;
+    if (pause > m_gc.stats.pauseMax) m_gc.stats.pauseMax = pause;
+    m_gc.stats.pauseHist[bucketOf(pause / 1000)]++;
+
+    // A pending compaction keeps the VMs polling.
+    AUP_AtomicStore(&aup_stopRequest, m_gc.compactPending ? 1 : 0);
+    m_gc.stopping = false;
+    aup_broadcast(&m_gc.resume);
+}
+
+// Visits the registers of [vm] its frames' stack maps say are
+// live. A frame below the top one is stopped in its call, the
+// top one where its ip points.
+static void eachLiveSlot(aupVM *vm, void (* visit)(aupVal *slot))
+{
+    // Without frames only the compiler's functions or a routine's
+    // result are kept on the stack.
+    if (vm->frameCount == 0)
+    {
+        for (aupVal *slot = vm->stack; slot < vm->top; slot++)
+        {
+            visit(slot);
+        }
+        return;
+    }
+
+    for (int i = 0; i < vm->frameCount; i++)
+    {
+        aupFrame *frame = &vm->frames[i];
+        aupFun *function = frame->function;
+        uint32_t *ip = frame->ip - (i < vm->frameCount - 1);
+        const uint64_t *map = aup_stackMap(function, ip);
+
+        if (map == NULL)
+        {
+            for (int r = 0; r < function->regs; r++)
+            {
+                visit(&frame->stack[r]);
+            }
+            continue;
+        }
+
+        for (int r = 0; r < function->regs; r++)
+        {
+            if (map[r / 64] & ((uint64_t)1 << (r % 64)))
+            {
+                visit(&frame->stack[r]);
+            }
+        }
+    }
+}
+
+static void markSlot(aupVal *slot)
+{
+    markValue(&m_gc.gray, *slot);
+}
+
+#ifdef AUP_CHECKMAPS
+static void flagSlot(aupVal *slot)
+{
+    m_slotLive[slot - m_slotBase] = 1;
+}
+
+// Overwrites the registers of [vm] no stack map keeps with
+// aup_deadValue. One wrongly called dead then trips
+// aup_checkSlot when read, instead of handing out an object
+// the sweep may have freed.
+static void poisonDeadSlots(aupVM *vm)
+{
+    if (vm->frameCount == 0) return;
+
+    aupVal *end = vm->stack;
+    for (int i = 0; i < vm->frameCount; i++)
+    {
+        aupFrame *frame = &vm->frames[i];
+        aupVal *regs = frame->stack + frame->function->regs;
+        if (regs > end) end = regs;
+    }
+
+    size_t count = end - vm->stack;
+    if (count > m_slotSpace)
+    {
+        m_slotSpace = count;
+        m_slotLive = realloc(m_slotLive, m_slotSpace);
+    }
+    memset(m_slotLive, 0, count);
+    m_slotBase = vm->stack;
+
+    eachLiveSlot(vm, flagSlot);
+    for (aupUpv *upvalue = vm->openUpvals;
+        upvalue != NULL;
+        upvalue = upvalue->next)
+    {
+        if (upvalue->location >= vm->stack && upvalue->location < end)
+        {
+            m_slotLive[upvalue->location - vm->stack] = 1;
+        }
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (!m_slotLive[i]) vm->stack[i] = AUP_VObj(&aup_deadValue);
+    }
+}
+#endif
+
+static void markRoots()
+{
+    Gray *gray = &m_gc.gray;
+    aupVM *vm = m_gc.root;
+    if (vm != NULL) do
+    {
+        // Mark the task a routine reports to
+        markObject(gray, (aupObj *)vm->task);
+
+        // Mark temp objects
+        for (int i = 0; i < vm->numRoots; i++)
+        {
+            markObject(gray, vm->tempRoots[i]);
+        }
+
+        // Mark the live registers
+        eachLiveSlot(vm, markSlot);
+#ifdef AUP_CHECKMAPS
+        poisonDeadSlots(vm);
+#endif
+
+        // Mark call frames
+        for (int i = 0; i < vm->frameCount; i++)
+        {
+            markObject(gray, (aupObj *)vm->frames[i].function);
+        }
+
+        // Mark upvalues
+        for (aupUpv *upvalue = vm->openUpvals;
+            upvalue != NULL;
+            upvalue = upvalue->next)
+        {
+            // A dead register may still be captured.
+            markObject(gray, (aupObj *)upvalue);
+            markValue(gray, *upvalue->location);
+        }
+
+        vm = vm->next;
+    } while (vm != m_gc.root);
+
+    markTable(gray, &m_gc.globals);
+    markArray(gray, &m_gc.globalValues);
+}
+
+// Blackens gray objects until none is left or the slice runs
+// out of work units or time, returns true once marking is done.
+static bool traceGray(double *work, uint64_t deadline)
+{
+    Gray *gray = &m_gc.gray;
+
+    for (int n = 1; gray->count > 0; n++)
+    {
+        if (*work <= 0) return false;
+        if ((n & 63) == 0 && aup_nanoTime() > deadline) return false;
+
+        blackenObject(gray, gray->items[--gray->count]);
+        *work -= 1;
+    }
+
+    return true;
+}
+
+// Moves the top chunk of [gray] to the pool for an idle thread.
+static void shareGray(Gray *gray)
+{
+    gray->count -= CHUNK_SIZE;
+
+    aup_lock(&m_mark.lock);
+    Chunk *chunk = m_mark.spare;
+    if (chunk != NULL) {
+        m_mark.spare = chunk->next;
+    }
+    else {
+        chunk = malloc(sizeof(Chunk));
+    }
+
+    memcpy(chunk->items, gray->items + gray->count, sizeof(chunk->items));
+    chunk->next = m_mark.pool;
+    m_mark.pool = chunk;
+    aup_signal(&m_mark.work);
+    aup_unlock(&m_mark.lock);
+}
+
+// Called with [gray] empty, waits for a pooled chunk. Returns
+// false once every thread of the drain waits, marking is done.
+static bool takeGray(Gray *gray)
+{
+    aup_lock(&m_mark.lock);
+
+    for (;;)
+    {
+        if (m_mark.pool != NULL)
+        {
+            Chunk *chunk = m_mark.pool;
+            m_mark.pool = chunk->next;
+            for (int i = 0; i < CHUNK_SIZE; i++)
+            {
+                pushGray(gray, chunk->items[i]);
+            }
+            chunk->next = m_mark.spare;
+            m_mark.spare = chunk;
+            aup_unlock(&m_mark.lock);
+            return true;
+        }
+
+        if (m_mark.finished || AUP_AtomicLoad(&m_mark.idle) + 1 == m_mark.active)
+        {
+            m_mark.finished = true;
+            aup_broadcast(&m_mark.work);
+            aup_unlock(&m_mark.lock);
+            return false;
+        }
+
+        AUP_AtomicAdd(&m_mark.idle, 1);
+        aup_wait(&m_mark.work, &m_mark.lock);
+        AUP_AtomicAdd(&m_mark.idle, -1);
+    }
+}
+
+// One thread's part of a parallel drain.
+static void traceShared(Gray *gray)
+{
+    do
+    {
+        while (gray->count > 0)
+        {
+            blackenObject(gray, gray->items[--gray->count]);
+
+            if (gray->count >= 2 * CHUNK_SIZE && AUP_AtomicLoad(&m_mark.idle) > 0)
+            {
+                shareGray(gray);
+            }
+        }
+    } while (takeGray(gray));
+}
+
+static void helper(void *arg)
+{
+    Helper *self = (Helper *)arg;
+
+    aup_lock(&m_mark.lock);
+    for (;;)
+    {
+        while (m_mark.round == self->round && !m_mark.stopping)
+        {
+            aup_wait(&m_mark.start, &m_mark.lock);
+        }
+        if (m_mark.stopping) break;
+
+        self->round = m_mark.round;
+        aup_unlock(&m_mark.lock);
+
+        traceShared(&self->gray);
+
+        aup_lock(&m_mark.lock);
+        if (--m_mark.running == 0) aup_signal(&m_mark.done);
+    }
+    aup_unlock(&m_mark.lock);
+}
+
+static void startHelpers()
+{
+    int count = m_mark.threadCount - 1;
+
+    m_mark.threads = malloc(sizeof(aupThread) * count);
+    m_mark.helpers = malloc(sizeof(Helper) * count);
+    memset(m_mark.helpers, '\0', sizeof(Helper) * count);
+    m_mark.stopping = false;
+
+    for (int i = 0; i < count; i++)
+    {
+        m_mark.helpers[i].round = m_mark.round;
+        if (!aup_startThread(&m_mark.threads[i], helper, &m_mark.helpers[i])) break;
+        m_mark.helperCount++;
+    }
+}
+
+static void stopHelpers()
+{
+    if (m_mark.threads == NULL) return;
+
+    aup_lock(&m_mark.lock);
+    m_mark.stopping = true;
+    aup_broadcast(&m_mark.start);
+    aup_unlock(&m_mark.lock);
+
+    for (int i = 0; i < m_mark.helperCount; i++)
+    {
+        aup_joinThread(m_mark.threads[i]);
+        free(m_mark.helpers[i].gray.items);
+    }
+
+    free(m_mark.threads);
+    free(m_mark.helpers);
+    m_mark.threads = NULL;
+    m_mark.helpers = NULL;
+    m_mark.helperCount = 0;
+}
+
+// Traces until no gray object is left, the world is stopped.
+// With more GC threads configured they all take part, setting
+// mark bits atomically.
+static void drain()
+{
+    Gray *gray = &m_gc.gray;
+
+    if (m_mark.threadCount > 1 && m_mark.threads == NULL)
+    {
+        startHelpers();
+    }
+
+    if (m_mark.helperCount == 0 || gray->count == 0)
+    {
+        while (gray->count > 0)
+        {
+            blackenObject(gray, gray->items[--gray->count]);
+        }
+        return;
+    }
+
+    aup_lock(&m_mark.lock);
+    m_gc.parallel = true;
+    m_mark.active = m_mark.helperCount + 1;
+    m_mark.running = m_mark.helperCount;
+    m_mark.finished = false;
+    m_mark.round++;
+    aup_broadcast(&m_mark.start);
+    aup_unlock(&m_mark.lock);
+
+    traceShared(gray);
+
+    aup_lock(&m_mark.lock);
+    while (m_mark.running > 0)
+    {
+        aup_wait(&m_mark.done, &m_mark.lock);
+    }
+    m_gc.parallel = false;
+    aup_unlock(&m_mark.lock);
+
+    for (int i = 0; i < m_mark.helperCount; i++)
+    {
+        gray->blackened += m_mark.helpers[i].gray.blackened;
+        m_mark.helpers[i].gray.blackened = 0;
+    }
+}
+
+// Traces the young generation only, the world is stopped.
+static void minorCollect()
+{
+    stopWorld();
+    m_gc.minor = true;
+
+    /* === Mark roots === */
+    markRoots();
+
+    // Old objects written with young values
+    for (int i = 0; i < m_gc.rememberedCount; i++)
+    {
+        aupObj *object = m_gc.remembered[i];
+        object->isRemembered = false;
+        blackenObject(&m_gc.gray, object);
+    }
+    m_gc.rememberedCount = 0;
+
+    /* === Trace references === */
+    drain();
+
+    /* === Sweep === */
+    sweepYoung(&m_gc.young);
+
+    m_gc.minor = false;
+    m_gc.youngAllocated = 0;
+    m_gc.stats.minors++;
+    recordCollection();
+    resumeWorld();
+}
+
+static void marker(void *arg);
+
+// Starts a major cycle, the young generation is emptied first
+// so the whole heap is one list while marking.
+static void startCycle()
+{
+    minorCollect();
+    stopWorld();
+
+    for (int i = 0; i < m_gc.rememberedCount; i++)
+    {
+        m_gc.remembered[i]->isRemembered = false;
+    }
+    m_gc.rememberedCount = 0;
+
+    markRoots();
+
+    // Mark and sweep each touch every object once, spread over
+    // the allocation of another half heap, or of what is left
+    // below the soft limit.
+    size_t budget = m_gc.allocated / 2;
+    if (m_gc.softLimit > 0)
+    {
+        size_t room = (m_gc.allocated < m_gc.softLimit) ?
+            m_gc.softLimit - m_gc.allocated : 0;
+        if (budget > room) budget = room;
+    }
+    budget += AUP_GC_STEP;
+    m_gc.workPerByte = 2.0 * m_gc.objectCount / budget;
+    m_gc.workDebt = 0;
+
+    m_gc.phase = GC_MARK;
+    aup_gcMarking = true;
+    m_gc.stats.slices++;
+
+    if (m_gc.concurrent) {
+        if (!m_gc.markerStarted) {
+            m_gc.markerStarted = aup_startThread(&m_gc.marker, marker, NULL);
+        }
+        aup_signal(&m_gc.markWake);
+    }
+
+    resumeWorld();
+}
+
+// The remark pause, stacks and open upvalues are scanned once
+// more and marking is finished in one go.
+static void finishMark()
+{
+    aupTab *strings = &m_gc.strings;
+
+    markRoots();
+    drain();
+
+    /* === Remove unreferenced strings === */
+    for (int i = 0; i <= strings->capMask; i++)
+    {
+        aupStr *key = strings->entries[i].key;
+        if (key != NULL && !aup_slabIsMarked(key))
+        {
+            aup_removeKey(strings, key);
+        }
+    }
+
+    // From here on allocations go to the young list again, and
+    // sweep a page of their size class before they take it.
+    aup_gcMarking = false;
+    m_gc.phase = GC_SWEEP;
+    aup_slabStartSweep();
+}
+
+// Sweeps the pages allocation has not reached yet.
+static bool sweepStep(double *work, uint64_t deadline)
+{
+    for (int n = 1; ; n++)
+    {
+        if (*work <= 0) return false;
+        if ((n & 7) == 0 && aup_nanoTime() > deadline) return false;
+
+        int swept = aup_slabSweepOne();
+        if (swept < 0) return true;
+        *work -= swept + 1;
+    }
+}
+
+// Heap size the next cycle starts at, [live] bytes times the
+// growth factor within the heap limits. Near the soft limit
+// the growth is cut short, a cycle starts once half the room
+// left below it is allocated.
+static size_t nextThreshold(size_t live)
+{
+    double next = live * m_gc.growth;
+
+    if (m_gc.softLimit > 0)
+    {
+        double room = (live < m_gc.softLimit) ?
+            (m_gc.softLimit - live) / 2.0 : 0;
+        if (next > live + room) next = live + room;
+    }
+
+    if (next < m_gc.heapMin) next = m_gc.heapMin;
+    if (m_gc.heapMax > 0 && next > m_gc.heapMax) next = m_gc.heapMax;
+
+    // Cycles never run back to back.
+    if (next < live + AUP_GC_STEP) next = live + AUP_GC_STEP;
+    return (size_t)next;
+}
+
+// The running cycle falls too far behind the mutators and is
+// finished in one pause.
+static bool farBehind()
+{
+    size_t allocated = AUP_AtomicLoad(&m_gc.allocated);
+    return allocated > m_gc.nextGC * 2 ||
+        (m_gc.softLimit > 0 && allocated > m_gc.softLimit);
+}
+
+// Advances the running cycle by [work] units, the world is
+// stopped. Work cut short by the pause target is owed by the
+// next slice.
+static void advance(double work, uint64_t deadline)
+{
+    if (m_gc.phase == GC_MARK)
+    {
+        // Unbounded work finishes the cycle on every GC thread.
+        if (isinf(work)) drain();
+        if (traceGray(&work, deadline)) finishMark();
+    }
+
+    if (m_gc.phase == GC_SWEEP && sweepStep(&work, deadline))
+    {
+        m_gc.phase = GC_IDLE;
+        m_gc.live = m_gc.allocated;
+        m_gc.nextGC = nextThreshold(m_gc.live);
+        m_gc.stats.cycles++;
+        recordCollection();
+        work = 0;
+
+        size_t spare = aup_slabSparePages();
+        if (m_gc.compact && (m_gc.stress == AUP_GC_STRESS_COMPACT ? spare > 0 :
+            spare >= AUP_COMPACT_PAGES && spare * 8 >= aup_slabPages()))
+        {
+            m_gc.compactPending = true;
+        }
+    }
+
+    m_gc.workDebt = (work > 0) ? work : 0;
+}
+
+// One slice of the running cycle, paced by the bytes allocated
+// since the last one and cut short at the pause target.
+static void step()
+{
+    // The marker thread does the tracing, unless it falls far
+    // behind the mutators.
+    if (m_gc.phase == GC_MARK && m_gc.concurrent && m_gc.markerStarted &&
+        !farBehind())
+    {
+        AUP_AtomicStore(&m_gc.youngAllocated, 0);
+        return;
+    }
+
+    stopWorld();
+    m_gc.stats.slices++;
+
+    double work = m_gc.workDebt + m_gc.youngAllocated * m_gc.workPerByte;
+    uint64_t deadline = aup_nanoTime() + m_gc.pauseNs;
+    m_gc.youngAllocated = 0;
+
+    // Far behind the mutators, finish the cycle now.
+    if (farBehind())
+    {
+        work = HUGE_VAL;
+        deadline = UINT64_MAX;
+    }
+
+    advance(work, deadline);
+    resumeWorld();
+}
+
+static void *forward(void *object)
+{
+    return (object != NULL) ? aup_slabForward(object) : NULL;
+}
+
+static void forwardValue(aupVal *value)
+{
+    if (AUP_IsObj(*value)) *value = AUP_VObj(forward(AUP_AsObj(*value)));
+}
+
+static void forwardArray(aupArr *array)
+{
+    for (int i = 0; i < array->count; i++) {
+        forwardValue(&array->values[i]);
+    }
+}
+
+// Keys keep their hash, entries stay where they are.
+static void forwardTable(aupTab *table)
+{
+    for (int i = 0; i <= table->capMask; i++) {
+        aupEnt *entry = &table->entries[i];
+        entry->key = forward(entry->key);
+        forwardValue(&entry->value);
+    }
+}
+
+static void forwardFields(void *ptr)
+{
+    aupObj *object = (aupObj *)ptr;
+
+    switch (object->type) {
+        case AUP_OSTR:
+            break;
+        case AUP_OUPV: {
+            aupUpv *upvalue = (aupUpv *)object;
+            upvalue->next = forward(upvalue->next);
+            forwardValue(&upvalue->closed);
+            break;
+        }
+        case AUP_OFUN: {
+            aupFun *function = (aupFun *)object;
+            function->name = forward(function->name);
+            forwardArray(&function->chunk.constants);
+            if (function->upvals == NULL) break;
+            for (int i = 0; i < function->upvalCount; i++) {
+                function->upvals[i] = forward(function->upvals[i]);
+            }
+            break;
+        }
+        case AUP_OKLS: {
+            aupKls *klass = (aupKls *)object;
+            klass->name = forward(klass->name);
+            break;
+        }
+        case AUP_OINC: {
+            aupInc *instance = (aupInc *)object;
+            instance->klass = forward(instance->klass);
+            forwardTable(&instance->fields);
+            break;
+        }
+        case AUP_ONAT: {
+            aupNat *native = (aupNat *)object;
+            native->name = forward(native->name);
+            break;
+        }
+        case AUP_OTSK: {
+            forwardValue(&((aupTsk *)object)->result);
+            break;
+        }
+        case AUP_OROP: {
+            aupRop *rope = (aupRop *)object;
+            rope->owner = forward(rope->owner);
+            rope->flat = forward(rope->flat);
+            break;
+        }
+    }
+}
+
+// A closed upvalue and a string with inline bytes point into
+// themselves.
+static void relocate(void *from, void *to)
+{
+    aupUpv *upvalue = (aupUpv *)to;
+    aupStr *string = (aupStr *)to;
+
+    if (upvalue->base.type == AUP_OUPV &&
+        upvalue->location == &((aupUpv *)from)->closed)
+    {
+        upvalue->location = &upvalue->closed;
+    }
+    else if (string->base.type == AUP_OSTR &&
+        string->chars == ((aupStr *)from)->bytes)
+    {
+        string->chars = string->bytes;
+    }
+}
+
+static void forwardRoots()
+{
+    aupVM *vm = m_gc.root;
+    if (vm != NULL) do
+    {
+        vm->task = forward(vm->task);
+
+        for (int i = 0; i < vm->frameCount; i++)
+        {
+            vm->frames[i].function = forward(vm->frames[i].function);
+        }
+
+        // Same slots as markRoots, the dead ones may point
+        // anywhere.
+        eachLiveSlot(vm, forwardValue);
+
+        vm->openUpvals = forward(vm->openUpvals);
+        for (aupUpv *upvalue = vm->openUpvals;
+            upvalue != NULL;
+            upvalue = (aupUpv *)forward(upvalue->next))
+        {
+            forwardValue(upvalue->location);
+        }
+
+        vm = vm->next;
+    } while (vm != m_gc.root);
+
+    forwardTable(&m_gc.globals);
+    forwardArray(&m_gc.globalValues);
+    forwardTable(&m_gc.strings);
+
+    for (int i = 0; i < m_gc.rememberedCount; i++)
+    {
+        m_gc.remembered[i] = forward(m_gc.remembered[i]);
+    }
+
+    m_gc.young = forward(m_gc.young);
+    for (aupObj *object = m_gc.young; object != NULL;
+        object = (aupObj *)object->next)
+    {
+        object->next = (uintptr_t)forward((aupObj *)object->next);
+    }
+}
+
+// Moves the objects of sparse pages together and gives the
+// emptied pages back. Other threads may only be parked at a
+// safepoint, anything held in C locals elsewhere would be
+// left pointing at an old copy. Temp roots are pushed by C
+// code still using them and stay where they are.
+static void compact()
+{
+    m_gc.compactPending = false;
+    stopWorld();
+
+    if (m_gc.phase == GC_IDLE && m_gc.safeCount == m_gc.parkedCount)
+    {
+        aupVM *vm = m_gc.root;
+
+        // Marks are clear between cycles, a marked page stays.
+        if (vm != NULL) do
+        {
+            for (int i = 0; i < vm->numRoots; i++)
+            {
+                aup_slabMark(vm->tempRoots[i]);
+            }
+            vm = vm->next;
+        } while (vm != m_gc.root);
+
+        m_gc.stats.moved += aup_slabEvacuate(relocate);
+
+        if (vm != NULL) do
+        {
+            for (int i = 0; i < vm->numRoots; i++)
+            {
+                aup_slabUnmark(vm->tempRoots[i]);
+            }
+            vm = vm->next;
+        } while (vm != m_gc.root);
+
+        forwardRoots();
+        aup_slabEach(forwardFields);
+        aup_slabFreeEvacuated();
+        m_gc.stats.compactions++;
+    }
+
+    resumeWorld();
+}
+
+// Called with the heap lock held.
+static void collectFull()
+{
+    // Finish a running cycle first, its marks predate the call.
+    if (m_gc.phase != GC_IDLE)
+    {
+        stopWorld();
+        advance(HUGE_VAL, UINT64_MAX);
+        resumeWorld();
+    }
+
+    startCycle();
+    stopWorld();
+    advance(HUGE_VAL, UINT64_MAX);
+    resumeWorld();
+}
+
+void aup_collect()
+{
+    aup_lockHeap();
+    collectFull();
+    aup_unlockHeap();
+}
+
+// Traces the gray stack while the mutators run, a batch at a
+// time so they get the heap lock in between. The remark pause
+// is taken from here as well.
+static void marker(void *arg)
+{
+    (void)arg;
+    aup_lock(&m_gc.lock);
+
+    while (!m_gc.markerStop)
+    {
+        if (m_gc.stopping)
+        {
+            aup_wait(&m_gc.resume, &m_gc.lock);
+            continue;
+        }
+        if (m_gc.phase != GC_MARK || !m_gc.concurrent)
+        {
+            aup_wait(&m_gc.markWake, &m_gc.lock);
+            continue;
+        }
+
+        uint64_t blackened = m_gc.gray.blackened;
+        double work = AUP_GC_BATCH;
+        bool done = traceGray(&work, UINT64_MAX);
+        m_gc.stats.markedConcurrent += m_gc.gray.blackened - blackened;
+
+        if (done)
+        {
+            stopWorld();
+            m_gc.stats.slices++;
+            finishMark();
+            resumeWorld();
+        }
+        else
+        {
+            aup_unlock(&m_gc.lock);
+            aup_yieldThread();
+            aup_lock(&m_gc.lock);
+        }
+    }
+
+    aup_unlock(&m_gc.lock);
+}
+
+void aup_setGCPause(unsigned micros)
+{
+    aup_lockHeap();
+    m_gc.pauseNs = (uint64_t)micros * 1000;
+    aup_unlockHeap();
+}
+
+// Cycles started after the call mark on the marker thread,
+// if enabled, or in slices taken by the mutators.
+void aup_setGCConcurrent(bool enabled)
+{
+    aup_lockHeap();
+    m_gc.concurrent = enabled;
+    aup_unlockHeap();
+}
+
+// Threads tracing in a pause, the collecting one included.
+// Helpers are started again by the next collection.
+void aup_setGCThreads(int count)
+{
+    if (count < 1) count = 1;
+
+    aup_lockHeap();
+    stopHelpers();
+    m_mark.threadCount = count;
+    aup_unlockHeap();
+}
+
+// Cycles finished after the call leave sparse pages for a
+// compaction, if enabled.
+void aup_setGCCompact(bool enabled)
+{
+    aup_lockHeap();
+    m_gc.compact = enabled;
+    if (!enabled) m_gc.compactPending = false;
+    aup_unlockHeap();
+}
+
+// A cycle sets the heap size the next one starts at from what
+// survived it, times [factor].
+void aup_setGCGrowth(double factor)
+{
+    if (factor < 1.0) factor = 1.0;
+
+    aup_lockHeap();
+    m_gc.growth = factor;
+    if (m_gc.phase == GC_IDLE) m_gc.nextGC = nextThreshold(m_gc.live);
+    aup_unlockHeap();
+}
+
+// Bounds for the heap size a cycle starts at, [max] 0 for none.
+// A heap still larger than [max] after a cycle collects once
+// every slice worth of allocation.
+void aup_setGCHeapLimits(size_t min, size_t max)
+{
+    aup_lockHeap();
+    m_gc.heapMin = min;
+    m_gc.heapMax = max;
+    if (m_gc.phase == GC_IDLE) m_gc.nextGC = nextThreshold(m_gc.live);
+    aup_unlockHeap();
+}
+
+// Not a hard limit, cycles start sooner and finish faster as the
+// heap nears [bytes]. 0 turns it off.
+void aup_setGCSoftLimit(size_t bytes)
+{
+    aup_lockHeap();
+    m_gc.softLimit = bytes;
+    if (m_gc.phase == GC_IDLE) m_gc.nextGC = nextThreshold(m_gc.live);
+    aup_unlockHeap();
+}
+
+// One of AUP_GC_STRESS_*, for testing only: every allocation
+// collects.
+void aup_setGCStress(int mode)
+{
+    if (mode < AUP_GC_STRESS_OFF || mode > AUP_GC_STRESS_COMPACT) return;
+
+    aup_lockHeap();
+    AUP_AtomicStore(&m_gc.stress, mode);
+    aup_unlockHeap();
+}
+
+void aup_getGCStats(aupGCStats *stats)
+{
+    aup_lockHeap();
+    *stats = m_gc.stats;
+    stats->marked = m_gc.gray.blackened;
+    stats->pages = aup_slabPages();
+    aup_unlockHeap();
+}
+
+#ifdef AUP_GCSTATS
+void aup_dumpGCStats()
+{
+    aupGCStats stats;
+    aup_getGCStats(&stats);
+
+    fprintf(stderr, "=== gc ===\n");
+    fprintf(stderr, "minors    %12llu\n", (unsigned long long)stats.minors);
+    fprintf(stderr, "cycles    %12llu\n", (unsigned long long)stats.cycles);
+    fprintf(stderr, "pauses    %12llu\n", (unsigned long long)stats.slices);
+    fprintf(stderr, "marked    %12llu\n", (unsigned long long)stats.marked);
+    fprintf(stderr, "off-thread%12llu %6.2f%%\n",
+        (unsigned long long)stats.markedConcurrent,
+        stats.marked ? stats.markedConcurrent * 100.0 / stats.marked : 0.0);
+    fprintf(stderr, "compacted %12llu %llu moved\n",
+        (unsigned long long)stats.compactions, (unsigned long long)stats.moved);
+    fprintf(stderr, "pages     %12llu\n", (unsigned long long)stats.pages);
+    fprintf(stderr, "paused    %12.3f ms, %.3f ms max\n",
+        stats.pauseTotal / 1e6, stats.pauseMax / 1e6);
+    fprintf(stderr, "freed     %12llu\n", (unsigned long long)stats.freed);
+
+    for (int i = 0; i < AUP_GC_BUCKETS; i++)
+    {
+        if (stats.pauseHist[i] == 0) continue;
+        fprintf(stderr, "  <%8llu us %10llu\n",
+            (unsigned long long)2 << i, (unsigned long long)stats.pauseHist[i]);
+    }
+}
+#endif
+
+// gc_collect(), a full collection.
+static aupVal collectNative(aupVM *vm, int argc, aupVal *args)
+{
+    (void)vm, (void)argc, (void)args;
+    aup_collect();
+    return AUP_VNil;
+}
+
+static bool isName(aupVal value, const char *name)
+{
+    return AUP_IsStr(value) && strcmp(AUP_AsCStr(value), name) == 0;
+}
+
+// gc_tune(name[, value]) -> the value before. Tunables are
+// "growth", "min", "max" and "soft" in bytes, "pause" in
+// microseconds, and "stress", one of AUP_GC_STRESS_*.
+static aupVal tuneNative(aupVM *vm, int argc, aupVal *args)
+{
+    (void)vm;
+    if (argc < 1) return AUP_VNil;
+
+    aup_lockHeap();
+    double growth = m_gc.growth;
+    size_t min = m_gc.heapMin, max = m_gc.heapMax;
+    size_t soft = m_gc.softLimit;
+    double pause = m_gc.pauseNs / 1000.0;
+    int stress = m_gc.stress;
+    aup_unlockHeap();
+
+    aupVal name = args[0];
+    double old;
+    if (isName(name, "growth")) old = growth;
+    else if (isName(name, "min")) old = (double)min;
+    else if (isName(name, "max")) old = (double)max;
+    else if (isName(name, "soft")) old = (double)soft;
+    else if (isName(name, "pause")) old = pause;
+    else if (isName(name, "stress")) old = stress;
+    else return AUP_VNil;
+
+    if (argc < 2 || !AUP_IsNum(args[1]) || AUP_AsNum(args[1]) < 0)
+    {
+        return AUP_VNum(old);
+    }
+
+    double value = AUP_AsNum(args[1]);
+    if (isName(name, "growth")) aup_setGCGrowth(value);
+    else if (isName(name, "min")) aup_setGCHeapLimits((size_t)value, max);
+    else if (isName(name, "max")) aup_setGCHeapLimits(min, (size_t)value);
+    else if (isName(name, "soft")) aup_setGCSoftLimit((size_t)value);
+    else if (isName(name, "stress")) aup_setGCStress((int)value);
+    else aup_setGCPause((unsigned)value);
+
+    return AUP_VNum(old);
+}
+
+// gc_stat(name[, bucket]) -> number, one of the counters of
+// aupGCStats. The histograms "pause_hist", "freed_hist" and
+// "heap_hist" take the bucket to read.
+static aupVal statNative(aupVM *vm, int argc, aupVal *args)
+{
+    (void)vm;
+    if (argc < 1) return AUP_VNil;
+
+    aupGCStats stats;
+    aup_getGCStats(&stats);
+
+    static const struct {
+        const char *name;
+        size_t offset;
+    } counters[] = {
+        { "minors",      offsetof(aupGCStats, minors) },
+        { "cycles",      offsetof(aupGCStats, cycles) },
+        { "pauses",      offsetof(aupGCStats, slices) },
+        { "marked",      offsetof(aupGCStats, marked) },
+        { "marked_concurrent", offsetof(aupGCStats, markedConcurrent) },
+        { "compactions", offsetof(aupGCStats, compactions) },
+        { "moved",       offsetof(aupGCStats, moved) },
+        { "pages",       offsetof(aupGCStats, pages) },
+        { "pause_total", offsetof(aupGCStats, pauseTotal) },
+        { "pause_max",   offsetof(aupGCStats, pauseMax) },
+        { "freed",       offsetof(aupGCStats, freed) },
+        { "heap",        offsetof(aupGCStats, heap) },
+    };
+
+    for (int i = 0; i < (int)(sizeof(counters) / sizeof(counters[0])); i++)
+    {
+        if (isName(args[0], counters[i].name))
+        {
+            uint64_t value = *(uint64_t *)((char *)&stats + counters[i].offset);
+            return AUP_VNum((double)value);
+        }
+    }
+
+    static const struct {
+        const char *name;
+        size_t offset;
+    } histograms[] = {
+        { "pause_hist", offsetof(aupGCStats, pauseHist) },
+        { "freed_hist", offsetof(aupGCStats, freedHist) },
+        { "heap_hist",  offsetof(aupGCStats, heapHist) },
+    };
+
+    for (int i = 0; i < (int)(sizeof(histograms) / sizeof(histograms[0])); i++)
+    {
+        if (isName(args[0], histograms[i].name))
+        {
+            if (argc < 2 || !AUP_IsNum(args[1])) return AUP_VNil;
+            int bucket = AUP_AsInt(args[1]);
+            if (bucket < 0 || bucket >= AUP_GC_BUCKETS) return AUP_VNil;
+
+            uint64_t *hist = (uint64_t *)((char *)&stats + histograms[i].offset);
+            return AUP_VNum((double)hist[bucket]);
+        }
+    }
+    return AUP_VNil;
+}
+
+void aup_initGCLib(aupVM *vm)
+{
+    aup_defineNative(vm, "gc_collect", collectNative);
+    aup_defineNative(vm, "gc_tune", tuneNative);
+    aup_defineNative(vm, "gc_stat", statNative);
 }
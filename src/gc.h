@@ -5,22 +5,195 @@
 #include "util.h"
 #include "object.h"
 
+// Default ceiling of an arena heap, in bytes.
+#define AUP_ARENA_LIMIT     (64 * 1024 * 1024)
+
+// Heap size the first major cycle starts at, and the one a
+// cycle sets for the next by default: what survived it, times
+// the growth factor.
+#define AUP_GC_HEAP_MIN     (1024 * 1024)
+#define AUP_GC_GROWTH       2.0
+
+// Bytes allocated between two minor collections.
+#define AUP_NURSERY_SIZE    (512 * 1024)
+
+// Bytes allocated between two slices of a major cycle.
+#define AUP_GC_STEP         (64 * 1024)
+
+// Default target length of one slice, in microseconds.
+#define AUP_GC_PAUSE        1000
+
+// Objects the marker thread traces between two looks at
+// the heap lock.
+#define AUP_GC_BATCH        256
+
+// Most threads tracing in a pause by default, one per core.
+#define AUP_GC_THREADS      8
+
+// Fewest pages a compaction has to give back, it must also
+// free an eighth of the heap.
+#define AUP_COMPACT_PAGES   4
+
+// Collections forced at every allocation, to shake out missing
+// roots and wrong stack maps: a minor one, a full cycle, or a
+// full cycle followed by a compaction at the next safepoint
+// whenever a page can be given back.
+#define AUP_GC_STRESS_OFF       0
+#define AUP_GC_STRESS_MINOR     1
+#define AUP_GC_STRESS_MAJOR     2
+#define AUP_GC_STRESS_COMPACT   3
+
+#ifdef AUP_CHECKMAPS
+#include <stdio.h>
+#include <stdlib.h>
+
+// Build with -DAUP_CHECKMAPS to check the compiler's stack maps.
+// Every root scan overwrites the registers they call dead with
+// this value, reading one back means a live register was left
+// unscanned.
+extern aupObj aup_deadValue;
+
+static inline aupVal *aup_checkSlot(aupVal *slot) {
+    if (AUP_IsObj(*slot) && AUP_AsObj(*slot) == &aup_deadValue) {
+        fprintf(stderr, "Read a register the stack map calls dead.\n");
+        abort();
+    }
+    return slot;
+}
+#endif
+
 #define AUP_PushRoot(vm, obj) \
     ((vm)->tempRoots[(vm)->numRoots++] = (obj))
 #define AUP_PopRoot(vm) \
     ((vm)->numRoots--)
 
-void aup_initGC();
+void aup_initGC(size_t arenaLimit);
 void aup_freeGC();
 
+// Defines the gc_* natives.
+void aup_initGCLib(aupVM *vm);
+
+void aup_attachVM(aupVM *vm, aupVM *from);
+bool aup_detachVM(aupVM *vm);
+
+// Raised while a collection waits for the other threads,
+// running VMs poll it at calls and backward jumps.
+extern volatile int aup_stopRequest;
+
+// Set while a major cycle marks, incrementally or on the
+// marker thread. Only changes with the world stopped.
+extern volatile int aup_gcMarking;
+
+#define AUP_GC_BUCKETS      32
+
+typedef struct {
+    uint64_t minors;            // minor collections
+    uint64_t cycles;            // major cycles finished
+    uint64_t slices;            // pauses taken by major cycles
+    uint64_t marked;            // objects traced by major cycles
+    uint64_t markedConcurrent;  // of those, by the marker thread
+    uint64_t compactions;       // compactions run
+    uint64_t moved;             // objects moved by them
+    uint64_t pages;             // heap pages mapped
+
+    uint64_t pauseTotal;        // nanoseconds the world was stopped
+    uint64_t pauseMax;          // longest pause, in nanoseconds
+    uint64_t freed;             // object bytes freed by collections
+    uint64_t heap;              // bytes in use after the last one
+
+    // Log2 histograms, bucket i counts values in [2^i, 2^(i+1)),
+    // the first one everything below 2.
+    uint64_t pauseHist[AUP_GC_BUCKETS];     // per pause, microseconds
+    uint64_t freedHist[AUP_GC_BUCKETS];     // per collection, KB
+    uint64_t heapHist[AUP_GC_BUCKETS];      // after a collection, KB
+} aupGCStats;
+
+void aup_enterHeap();
+void aup_leaveHeap();
+void aup_safepoint();
+void aup_lockHeap();
+void aup_unlockHeap();
+
 aupTab *aup_getStrings();
 aupTab *aup_getGlobals();
+aupArr *aup_getGlobalValues();
+
+int  aup_globalSlot(aupStr *name);
+bool aup_getGlobal(aupStr *name, aupVal *value);
+void aup_setGlobal(aupStr *name, aupVal value);
+
+// Global slots are shared by every thread. A NaN-boxed value is
+// one word and moves with a single atomic access, a tagged one
+// is two and takes a spin lock that can't park, so no safepoint
+// falls between the halves.
+#ifdef AUP_NAN_BOXING
+static inline aupVal aup_loadGlobal(aupVal *slot) {
+    return (aupVal){ .raw = AUP_RelaxedLoad(&slot->raw) };
+}
+static inline void aup_storeGlobal(aupVal *slot, aupVal value) {
+    AUP_RelaxedStore(&slot->raw, value.raw);
+}
+#else
+aupVal aup_loadGlobal(aupVal *slot);
+void aup_storeGlobal(aupVal *slot, aupVal value);
+#endif
 
 void *aup_alloc(size_t size);
 void *aup_realloc(void *ptr, size_t old, size_t _new);
 void aup_dealloc(void *ptr, size_t);
 void *aup_allocObject(size_t size, aupTObj type);
+void aup_deallocObject(void *object, size_t size);
 
 void aup_collect();
+void aup_setGCPause(unsigned micros);
+void aup_setGCConcurrent(bool enabled);
+void aup_setGCThreads(int count);
+void aup_setGCCompact(bool enabled);
+void aup_setGCGrowth(double factor);
+void aup_setGCHeapLimits(size_t min, size_t max);
+void aup_setGCSoftLimit(size_t bytes);
+void aup_setGCStress(int mode);
+void aup_getGCStats(aupGCStats *stats);
+#ifdef AUP_GCSTATS
+void aup_dumpGCStats();
+#endif
+
+void aup_remember(aupObj *object);
+void aup_shade(aupObj *object);
+void aup_storeValue(aupObj *owner, aupVal *slot, aupVal value);
+void aup_storeObject(aupObj *owner, aupObj **slot, aupObj *value);
+
+// Must follow every store of a value into an existing object,
+// old objects pointing to young ones are traced by minor
+// collections. Stack slots and globals are roots already.
+static inline void AUP_WriteBarrier(void *owner, aupVal value) {
+    aupObj *object = (aupObj *)owner;
+    if (object->isOld && !object->isRemembered &&
+        AUP_IsObj(value) && !AUP_AsObj(value)->isOld) {
+        aup_remember(object);
+    }
+}
+
+// Stores into a field of an existing object. While a cycle
+// marks, the overwritten value is shaded first (snapshot at
+// the beginning) and the store is made under the heap lock,
+// as the marker thread may be reading the field.
+static inline void AUP_SetValue(void *owner, aupVal *slot, aupVal value) {
+    if (aup_gcMarking) {
+        aup_storeValue((aupObj *)owner, slot, value);
+        return;
+    }
+    *slot = value;
+    AUP_WriteBarrier(owner, value);
+}
+
+static inline void AUP_SetObject(void *owner, void *slot, void *value) {
+    if (aup_gcMarking) {
+        aup_storeObject((aupObj *)owner, (aupObj **)slot, (aupObj *)value);
+        return;
+    }
+    *(aupObj **)slot = (aupObj *)value;
+    if (value != NULL) AUP_WriteBarrier(owner, AUP_VObj(value));
+}
 
 #endif
@@ -0,0 +1,289 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "jit.h"
+#include "code.h"
+#include "gc.h"
+
+#ifdef AUP_JIT
+
+#include <sys/mman.h>
+#include <unistd.h>
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS   MAP_ANON
+#endif
+
+// What goes into the 8 bytes at a stencil's hole
+typedef enum {
+    AUP_HOLE_RA,        // byte offset of register A
+    AUP_HOLE_RB,
+    AUP_HOLE_RC,
+    AUP_HOLE_KB,        // address of constant B
+    AUP_HOLE_KC,
+    AUP_HOLE_GLOBAL,    // address of the global slot
+    AUP_HOLE_IMM,       // raw operand
+    AUP_HOLE_PC,        // the instruction itself
+    AUP_HOLE_NEXT,      // code of the next instruction
+    AUP_HOLE_TARGET,    // code of the jump target
+    AUP_HOLE_SYM,       // a C function
+    AUP_HOLE_DATA,      // the stencil's read-only data
+} aupHoleKind;
+
+typedef struct {
+    uint16_t    offset;
+    uint8_t     kind;
+    const void  *symbol;
+    int64_t     addend;
+} aupHole;
+
+typedef struct {
+    const uint8_t *code;
+    uint16_t size;
+    uint16_t trim;      // bytes dropped when NEXT follows right behind
+    const uint8_t *data;
+    uint16_t dataSize;
+    const aupHole *holes;
+    uint16_t holeCount;
+} aupStencil;
+
+#include "stencils.h"
+
+#define ALIGN(n)    (((n) + 15) & ~(size_t)15)
+
+typedef struct {
+    const aupStencil *stencil;
+    int      next;
+    int      target;
+    uint32_t size;
+    uint32_t data;
+} Slot;
+
+// The stencil of an instruction and where it continues, anything
+// without one leaves to the interpreter.
+static aupStencilKind pick(const uint32_t *code, int count, int pc, Slot *slot)
+{
+    uint32_t inst = code[pc];
+    slot->next = pc + 1;
+    slot->target = -1;
+
+    switch (AUP_GetOp(inst)) {
+        case AUP_OP_PSH:
+        case AUP_OP_POP:    return AUP_STENCIL_NOP;
+        case AUP_OP_NIL:    return AUP_STENCIL_NIL;
+        case AUP_OP_BOOL:   return AUP_STENCIL_BOOL;
+
+        case AUP_OP_JMP:
+            slot->next = pc + 1 + AUP_GetAxx(inst);
+            return AUP_STENCIL_NOP;
+        case AUP_OP_JMPF:
+            slot->target = pc + 1 + AUP_GetAxx(inst);
+            return AUP_STENCIL_JMPF;
+        case AUP_OP_JNE:
+            slot->target = pc + 1 + AUP_GetAxx(inst);
+            return AUP_STENCIL_JNE;
+
+        // The offset is held by the following JMP
+        case AUP_OP_JLT:
+        case AUP_OP_JLT_NN:
+        case AUP_OP_JLE:
+        case AUP_OP_JLE_NN:
+        case AUP_OP_JEQ:
+            if (pc + 1 >= count) return AUP_STENCIL_EXIT;
+            slot->next = pc + 2;
+            slot->target = pc + 2 + AUP_GetAxx(code[pc + 1]);
+            switch (AUP_GetOp(inst)) {
+                case AUP_OP_JEQ:    return AUP_STENCIL_JEQ;
+                case AUP_OP_JLE:
+                case AUP_OP_JLE_NN: return AUP_STENCIL_JLE;
+                default:            return AUP_STENCIL_JLT;
+            }
+
+        case AUP_OP_NOT:    return AUP_STENCIL_NOT;
+        case AUP_OP_LT:
+        case AUP_OP_LT_NN:  return AUP_STENCIL_LT;
+        case AUP_OP_LE:
+        case AUP_OP_LE_NN:  return AUP_STENCIL_LE;
+        case AUP_OP_GT:
+        case AUP_OP_GT_NN:  return AUP_STENCIL_GT;
+        case AUP_OP_GE:
+        case AUP_OP_GE_NN:  return AUP_STENCIL_GE;
+        case AUP_OP_EQ:     return AUP_STENCIL_EQ;
+
+        case AUP_OP_NEG:    return AUP_STENCIL_NEG;
+        case AUP_OP_ADD:
+        case AUP_OP_ADD_NN: return AUP_STENCIL_ADD;
+        case AUP_OP_SUB:
+        case AUP_OP_SUB_NN: return AUP_STENCIL_SUB;
+        case AUP_OP_MUL:
+        case AUP_OP_MUL_NN: return AUP_STENCIL_MUL;
+        case AUP_OP_DIV:
+        case AUP_OP_DIV_NN: return AUP_STENCIL_DIV;
+        case AUP_OP_MOD:    return AUP_STENCIL_MOD;
+        case AUP_OP_POW:    return AUP_STENCIL_POW;
+
+        case AUP_OP_BNOT:   return AUP_STENCIL_BNOT;
+        case AUP_OP_BAND:   return AUP_STENCIL_BAND;
+        case AUP_OP_BOR:    return AUP_STENCIL_BOR;
+        case AUP_OP_BXOR:   return AUP_STENCIL_BXOR;
+        case AUP_OP_SHL:    return AUP_STENCIL_SHL;
+        case AUP_OP_SHR:    return AUP_STENCIL_SHR;
+
+        case AUP_OP_MOV:    return AUP_STENCIL_MOV;
+        case AUP_OP_LD:     return AUP_STENCIL_LD;
+
+        case AUP_OP_GLD:    return AUP_STENCIL_GLD;
+        case AUP_OP_GST:    return AUP_STENCIL_GST;
+
+        // Calls, returns, objects and upvalues
+        default:            return AUP_STENCIL_EXIT;
+    }
+}
+
+static uint64_t holeValue(aupFun *function, aupJit *jit, Slot *slots,
+    int pc, const aupHole *hole)
+{
+    uint32_t inst = function->chunk.code[pc];
+    aupVal *constants = function->chunk.constants.values;
+    aupVal *globals = aup_getGlobalValues()->values;
+    aupOp op = AUP_GetOp(inst);
+    uint64_t value;
+
+    switch (hole->kind) {
+        case AUP_HOLE_RA:
+            value = AUP_GetA(inst) * sizeof(aupVal);
+            break;
+        case AUP_HOLE_RB:
+            // JNE compares the register below C
+            value = (op == AUP_OP_JNE ? AUP_GetC(inst) - 1 : AUP_GetB(inst))
+                * sizeof(aupVal);
+            break;
+        case AUP_HOLE_RC:
+            value = AUP_GetC(inst) * sizeof(aupVal);
+            break;
+        case AUP_HOLE_KB:
+            value = (uintptr_t)&constants[AUP_GetB(inst)];
+            break;
+        case AUP_HOLE_KC:
+            value = (uintptr_t)&constants[AUP_GetC(inst)];
+            break;
+        case AUP_HOLE_GLOBAL:
+            value = (uintptr_t)&globals[op == AUP_OP_GST ?
+                (uint16_t)AUP_GetAxx(inst) : AUP_GetBxx(inst)];
+            break;
+        case AUP_HOLE_IMM:
+            value = op == AUP_OP_BOOL ? AUP_GetsB(inst) : AUP_GetA(inst);
+            break;
+        case AUP_HOLE_PC:
+            value = pc;
+            break;
+        case AUP_HOLE_NEXT:
+            value = (uintptr_t)(jit->code + jit->entries[slots[pc].next]);
+            break;
+        case AUP_HOLE_TARGET:
+            value = (uintptr_t)(jit->code + jit->entries[slots[pc].target]);
+            break;
+        case AUP_HOLE_SYM:
+            value = (uintptr_t)hole->symbol;
+            break;
+        default:
+            value = (uintptr_t)(jit->code + slots[pc].data);
+            break;
+    }
+    return value + hole->addend;
+}
+
+// Lays the stencils out one after another in instruction order,
+// then fills their holes. Left to the interpreter if no memory
+// can be mapped.
+void aup_jitCompile(aupFun *function)
+{
+    const uint32_t *code = function->chunk.code;
+    int count = function->chunk.count;
+
+    function->jit = NULL;
+    if (count == 0) return;
+
+    Slot *slots = malloc(sizeof(Slot) * count);
+    aupJit *jit = malloc(sizeof(aupJit) + sizeof(uint32_t) * count);
+    if (slots == NULL || jit == NULL) {
+        free(slots);
+        free(jit);
+        return;
+    }
+
+    size_t size = 0;
+    for (int pc = 0; pc < count; pc++) {
+        Slot *slot = &slots[pc];
+        aupStencilKind kind = pick(code, count, pc, slot);
+
+        // Only forward, the code always reaches an exit and with it
+        // the interpreter's preemption points.
+        if (slot->next <= pc || slot->next >= count || (slot->target != -1 &&
+            (slot->target <= pc || slot->target >= count))) {
+            kind = AUP_STENCIL_EXIT;
+        }
+
+        int variant = AUP_GetsB(code[pc]) << 1 | AUP_GetsC(code[pc]);
+        slot->stencil = &aup_stencils[kind][variant];
+        slot->size = slot->stencil->size;
+        if (slot->next == pc + 1) slot->size -= slot->stencil->trim;
+
+        jit->entries[pc] = (uint32_t)size;
+        size += slot->size;
+    }
+
+    // Constants of the stencils go behind the code
+    size = ALIGN(size);
+    for (int pc = 0; pc < count; pc++) {
+        slots[pc].data = (uint32_t)size;
+        size += ALIGN(slots[pc].stencil->dataSize);
+    }
+
+    long page = sysconf(_SC_PAGESIZE);
+    jit->size = (size + page - 1) & ~(size_t)(page - 1);
+    jit->code = mmap(NULL, jit->size, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (jit->code == MAP_FAILED) {
+        free(slots);
+        free(jit);
+        return;
+    }
+
+    for (int pc = 0; pc < count; pc++) {
+        const aupStencil *stencil = slots[pc].stencil;
+        uint8_t *at = jit->code + jit->entries[pc];
+
+        memcpy(at, stencil->code, slots[pc].size);
+        for (int i = 0; i < stencil->holeCount; i++) {
+            const aupHole *hole = &stencil->holes[i];
+            // Nothing is patched in the dropped jump
+            if (hole->offset + 8u > slots[pc].size) continue;
+            uint64_t value = holeValue(function, jit, slots, pc, hole);
+            memcpy(at + hole->offset, &value, 8);
+        }
+        if (stencil->dataSize > 0) {
+            memcpy(jit->code + slots[pc].data, stencil->data, stencil->dataSize);
+        }
+    }
+    free(slots);
+
+    if (mprotect(jit->code, jit->size, PROT_READ | PROT_EXEC) != 0) {
+        munmap(jit->code, jit->size);
+        free(jit);
+        return;
+    }
+    function->jit = jit;
+}
+
+void aup_jitFree(aupFun *function)
+{
+    aupJit *jit = function->jit;
+    if (jit == NULL) return;
+
+    munmap(jit->code, jit->size);
+    free(jit);
+    function->jit = NULL;
+}
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef _AUP_JIT_H
+#define _AUP_JIT_H
+#pragma once
+
+#include "object.h"
+
+#ifdef AUP_JIT
+
+// Machine code of a function, stitched together from the stencils
+// of src/stencils.h. Every instruction can be entered, the code runs
+// until an instruction it leaves to the interpreter. Build with
+// -DAUP_JIT to enable, the stencils are regenerated by
+// tools/stencils.py.
+struct _aupJit {
+    uint8_t  *code;
+    size_t   size;
+    uint32_t entries[];     // code offset of each instruction
+};
+
+typedef int aupJitFn(aupVal *regs);
+
+void aup_jitCompile(aupFun *function);
+void aup_jitFree(aupFun *function);
+
+// Runs the frame's code from [ip], returns where the interpreter
+// takes over.
+static inline uint32_t *aup_jitRun(aupFun *function, aupVal *regs, uint32_t *ip)
+{
+    aupJit *jit = function->jit;
+    uint32_t *code = function->chunk.code;
+    aupJitFn *entry = (aupJitFn *)(jit->code + jit->entries[ip - code]);
+    return code + entry(regs);
+}
+
+#endif
+
+#endif
@@ -1,17 +1,30 @@
 #include <stdio.h>
+#include <string.h>
 #include "vm.h"
 
 int main(int argc, char **argv)
 {
-    if (argc != 2) {
-        printf("usage: aup [file]\n");
+    // -a runs the script on an arena heap
+    bool arena = (argc == 3 && strcmp(argv[1], "-a") == 0);
+
+    if (argc != 2 && !arena) {
+        printf("usage: aup [-a] [file]\n");
         return 0;
     }
 
-    aupSrc *source = aup_newSource(argv[1]);
+    aupSrc *source = aup_newSource(argv[argc - 1]);
     if (source != NULL) {
-        aupVM *vm = aup_createVM(NULL);
+        aupVM *vm = arena ? aup_createArenaVM(0) : aup_createVM(NULL);
         aup_interpret(vm, source);
+#ifdef AUP_OPSTATS
+        aup_dumpOpStats(32);
+#endif
+#ifdef AUP_GCSTATS
+        aup_dumpGCStats();
+#endif
+#ifdef AUP_HASHBENCH
+        aup_benchHash();
+#endif
 
         aup_closeVM(vm);
         aup_freeSource(source);
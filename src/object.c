@@ -5,6 +5,8 @@
 #include "vm.h"
 #include "value.h"
 #include "object.h"
+#include "slab.h"
+#include "jit.h"
 
 void aup_printObject(aupObj *object)
 {
@@ -32,6 +34,20 @@ void aup_printObject(aupObj *object)
             printf("instance: %s@%p", instance->klass->name->chars, instance);
             break;
         }
+        case AUP_ONAT: {
+            aupNat *native = (aupNat *)object;
+            printf("native: %s@%p", native->name->chars, native);
+            break;
+        }
+        case AUP_OTSK: {
+            printf("task@%p", object);
+            break;
+        }
+        case AUP_OROP: {
+            aupRop *rope = (aupRop *)object;
+            printf("%.*s", rope->length, rope->bytes);
+            break;
+        }
         default:
             printf("obj: %p", object);
                 break;
@@ -40,24 +56,66 @@ void aup_printObject(aupObj *object)
 
 #define ALLOC(size) \
     aup_alloc(size)
-#define FREE(ptr, type) \
-    aup_dealloc(ptr, sizeof(type))
 #define FREE_ARR(ptr, type, count) \
     aup_dealloc(ptr, sizeof(type) * (count))
 
 #define ALLOC_OBJ(t, ot) \
     (t *)aup_allocObject(sizeof(t), ot)
 
+static aupStr *findString(const char *chars, int length, uint32_t hash)
+{
+    aup_lockHeap();
+    aupStr *interned = aup_findString(aup_getStrings(), chars, length, hash);
+    if (interned != NULL) aup_shade((aupObj *)interned);
+    aup_unlockHeap();
+    return interned;
+}
+
+// Header and bytes of a string take one slab slot if they fit,
+// anything longer would get a page of its own.
+static bool fitsInline(int length)
+{
+    return sizeof(aupStr) + length + 1 <= AUP_SLAB_MAX;
+}
+
+// Interns [string], unless another thread interned the same one
+// since the lookup. The loser is left for the collector.
+static aupStr *internString(aupStr *string)
+{
+    aup_lockHeap();
+    aupStr *interned = aup_findString(aup_getStrings(),
+        string->chars, string->length, string->hash);
+    if (interned == NULL) {
+        aup_setKey(aup_getStrings(), string, AUP_VNil);
+    }
+    else {
+        aup_shade((aupObj *)interned);
+    }
+    aup_unlockHeap();
+
+    return (interned != NULL) ? interned : string;
+}
+
+// [chars] is NULL for the bytes to go inline, the caller fills
+// them in before interning.
 static aupStr *allocString(char *chars, int length, uint32_t hash)
 {
-    aupStr *string = ALLOC_OBJ(aupStr, AUP_OSTR);
-    string->chars = chars;
+    aupStr *string;
+
+    if (chars == NULL) {
+        string = (aupStr *)aup_allocObject(sizeof(aupStr) + length + 1,
+            AUP_OSTR);
+        string->chars = string->bytes;
+        string->chars[length] = '\0';
+    }
+    else {
+        string = ALLOC_OBJ(aupStr, AUP_OSTR);
+        string->chars = chars;
+    }
+
     string->length = length;
     string->hash = hash;
-
-    //AUP_PushRoot(vm, (aupObj *)string);
-    aup_setKey(aup_getStrings(), string, AUP_VNil);
-    //AUP_PopRoot(vm);
+    string->borrowed = false;
     return string;
 }
 
@@ -69,43 +127,141 @@ aupStr *aup_catString(aupStr *s1, aupStr *s2)
     const char *cs1 = s1->chars;
     const char *cs2 = s2->chars;
 
-    uint32_t hash = aup_hashBytes(2, cs1, l1, cs2, l2);
-    aupStr *interned = aup_findString(aup_getStrings(), length, hash);
-    if (interned != NULL) return interned;
+    // Lookups compare bytes, which only exist together once
+    // copied, so a hit costs a string left to the collector.
+    aupHasher hasher;
+    aup_hashStart(&hasher);
+    aup_hashUpdate(&hasher, cs1, l1);
+    aup_hashUpdate(&hasher, cs2, l2);
+    uint32_t hash = aup_hashFinish(&hasher);
+
+    char *heapChars = NULL;
+    if (!fitsInline(length)) {
+        heapChars = ALLOC((length + 1) * sizeof(char));
+        heapChars[length] = '\0';
+    }
 
-    char *heapChars = ALLOC((length + 1) * sizeof(char));
-    memcpy(heapChars, cs1, l1);
-    memcpy(heapChars + l1 , cs2, l2);
-    heapChars[length] = '\0';
+    aupStr *string = allocString(heapChars, length, hash);
+    memcpy(string->chars, cs1, l1);
+    memcpy(string->chars + l1, cs2, l2);
 
-    return allocString(heapChars, length, hash);
+    return internString(string);
 }
 
 aupStr *aup_takeString(char *chars, int length)
 {
-    uint32_t hash = aup_hashBytes(1, chars, length);
-    aupStr *interned = aup_findString(aup_getStrings(), length, hash);
+    uint32_t hash = aup_hashBytes(chars, length);
+    aupStr *interned = findString(chars, length, hash);
     if (interned != NULL) {
-        FREE_ARR(chars, char, length);
+        FREE_ARR(chars, char, length + 1);
         return interned;
     }
 
-    return allocString(chars, length, hash);
+    if (!fitsInline(length)) {
+        return internString(allocString(chars, length, hash));
+    }
+
+    aupStr *string = allocString(NULL, length, hash);
+    memcpy(string->chars, chars, length);
+    FREE_ARR(chars, char, length + 1);
+    return internString(string);
 }
 
 aupStr *aup_copyString(const char *chars, int length)
 {
     if (length < 0) length = (int)strlen(chars);
 
-    uint32_t hash = aup_hashBytes(1, chars, length);
-    aupStr *interned = aup_findString(aup_getStrings(), length, hash);
+    uint32_t hash = aup_hashBytes(chars, length);
+    aupStr *interned = findString(chars, length, hash);
     if (interned != NULL) return interned;
 
-    char *heapChars = ALLOC((length + 1) * sizeof(char));
-    memcpy(heapChars, chars, length);
-    heapChars[length] = '\0';
+    char *heapChars = NULL;
+    if (!fitsInline(length)) {
+        heapChars = ALLOC((length + 1) * sizeof(char));
+        heapChars[length] = '\0';
+    }
+
+    aupStr *string = allocString(heapChars, length, hash);
+    memcpy(string->chars, chars, length);
+    return internString(string);
+}
+
+// [chars] is used in place and never freed, it has to be NUL
+// terminated and outlive the heap.
+aupStr *aup_borrowString(const char *chars, int length)
+{
+    if (length < 0) length = (int)strlen(chars);
+
+    uint32_t hash = aup_hashBytes(chars, length);
+    aupStr *interned = findString(chars, length, hash);
+    if (interned != NULL) return interned;
 
-    return allocString(heapChars, length, hash);
+    aupStr *string = allocString((char *)chars, length, hash);
+    string->borrowed = true;
+    return internString(string);
+}
+
+// [left] and [right] are strings or ropes. Appending to the end
+// of a rope takes the room left in its buffer, so building a
+// string piece by piece copies each byte about twice.
+aupRop *aup_concat(aupVal left, aupVal right)
+{
+    int l1, l2;
+    const char *cs1 = AUP_StrBytes(left, &l1);
+    const char *cs2 = AUP_StrBytes(right, &l2);
+    int length = l1 + l2;
+
+    if (AUP_IsRope(left)) {
+        aupRop *tail = AUP_AsRope(left);
+        aupRop *owner = (tail->owner != NULL) ? tail->owner : tail;
+
+        // Only one rope may extend the buffer from a given end.
+        if (l2 <= owner->capacity - l1 &&
+            AUP_AtomicCAS(&owner->used, l1, length)) {
+            memcpy(owner->bytes + l1, cs2, l2);
+
+            aupRop *rope = ALLOC_OBJ(aupRop, AUP_OROP);
+            rope->owner = owner;
+            rope->bytes = owner->bytes;
+            rope->length = length;
+            rope->capacity = 0;
+            rope->used = 0;
+            rope->flat = NULL;
+            return rope;
+        }
+    }
+
+    // A rope grows its buffer geometrically, a first concatenation
+    // takes what it needs.
+    int capacity = AUP_IsRope(left) ? length * 2 : length;
+    if (capacity < 16) capacity = 16;
+
+    char *bytes = ALLOC(capacity);
+    memcpy(bytes, cs1, l1);
+    memcpy(bytes + l1, cs2, l2);
+
+    aupRop *rope = ALLOC_OBJ(aupRop, AUP_OROP);
+    rope->owner = NULL;
+    rope->bytes = bytes;
+    rope->length = length;
+    rope->capacity = capacity;
+    rope->used = length;
+    rope->flat = NULL;
+    return rope;
+}
+
+// The interned string with the bytes of [value], a string or
+// a rope. A rope keeps it for the next time.
+aupStr *aup_flatten(aupVal value)
+{
+    if (AUP_IsStr(value)) return AUP_AsStr(value);
+
+    aupRop *rope = AUP_AsRope(value);
+    if (rope->flat == NULL) {
+        aupStr *flat = aup_copyString(rope->bytes, rope->length);
+        AUP_SetObject(rope, &rope->flat, flat);
+    }
+    return rope->flat;
 }
 
 aupFun *aup_newFunction(aupSrc *source)
@@ -113,20 +269,51 @@ aupFun *aup_newFunction(aupSrc *source)
     aupFun *function = ALLOC_OBJ(aupFun, AUP_OFUN);
 
     function->arity = 0;
+    function->locals = 0;
+    function->regs = 0;
     function->upvalCount = 0;
     function->upvals = NULL;
     function->name = NULL;
+    function->mapCount = 0;
+    function->mapOffsets = NULL;
+    function->maps = NULL;
+#ifdef AUP_JIT
+    function->jit = NULL;
+#endif
     aup_initChunk(&function->chunk, source);
 
     return function;
 }
 
+// The live registers of a frame stopped at [ip], NULL if the
+// compiler recorded no map there.
+const uint64_t *aup_stackMap(aupFun *function, const uint32_t *ip)
+{
+    uint32_t offset = (uint32_t)(ip - function->chunk.code);
+    int low = 0, high = function->mapCount - 1;
+
+    while (low <= high) {
+        int mid = (low + high) / 2;
+        if (function->mapOffsets[mid] < offset)
+            low = mid + 1;
+        else if (function->mapOffsets[mid] > offset)
+            high = mid - 1;
+        else
+            return function->maps + (size_t)mid * ((function->regs + 63) / 64);
+    }
+    return NULL;
+}
+
 void aup_makeClosure(aupFun *function)
 {
     size_t size = function->upvalCount * sizeof(aupUpv *);
     aupUpv **upvals = malloc(size);
     memset(upvals, '\0', size);
+
+    // The marker thread may be tracing the function.
+    aup_lockHeap();
     function->upvals = upvals;
+    aup_unlockHeap();
 }
 
 aupUpv *aup_newUpval(aupVal *slot)
@@ -154,35 +341,74 @@ aupInc *aup_newInstance(aupKls *klass)
     return instance;
 }
 
-void aup_freeObject(aupObj *object)
+aupNat *aup_newNative(aupStr *name, aupCFn fn)
+{
+    aupNat *native = ALLOC_OBJ(aupNat, AUP_ONAT);
+    native->fn = fn;
+    native->name = name;
+    return native;
+}
+
+aupTsk *aup_newTask()
+{
+    aupTsk *task = ALLOC_OBJ(aupTsk, AUP_OTSK);
+    task->vm = NULL;
+    task->result = AUP_VNil;
+    task->status = AUP_OK;
+    return task;
+}
+
+// Frees what [object] owns but not the object itself, returns
+// its size.
+size_t aup_releaseObject(aupObj *object)
 {
     switch (object->type) {
         case AUP_OSTR: {
             aupStr *string = (aupStr *)object;
-            FREE_ARR(string->chars, char, string->length);
-            FREE(string, aupStr);
-            break;
+            if (string->chars == string->bytes) {
+                return sizeof(aupStr) + string->length + 1;
+            }
+            if (!string->borrowed) {
+                FREE_ARR(string->chars, char, string->length + 1);
+            }
+            return sizeof(aupStr);
         }
         case AUP_OFUN: {
             aupFun *function = (aupFun *)object;
             aup_freeChunk(&function->chunk);
             if (function->upvalCount > 0) free(function->upvals);
-            FREE(function, aupFun);
-            break;
-        }
-        case AUP_OUPV: {
-            FREE(object, aupUpv);
-            break;
-        }
-        case AUP_OKLS: {
-            FREE(object, aupKls);
-            break;
+            free(function->mapOffsets);
+            free(function->maps);
+#ifdef AUP_JIT
+            aup_jitFree(function);
+#endif
+            return sizeof(aupFun);
         }
+        case AUP_OUPV:
+            return sizeof(aupUpv);
+        case AUP_OKLS:
+            return sizeof(aupKls);
         case AUP_OINC: {
             aupInc *instance = (aupInc *)object;
             aup_freeTable(&instance->fields);
-            FREE(object, aupInc);
-            break;
+            return sizeof(aupInc);
+        }
+        case AUP_ONAT:
+            return sizeof(aupNat);
+        case AUP_OTSK:
+            return sizeof(aupTsk);
+        case AUP_OROP: {
+            aupRop *rope = (aupRop *)object;
+            if (rope->owner == NULL) {
+                FREE_ARR(rope->bytes, char, rope->capacity);
+            }
+            return sizeof(aupRop);
         }
     }
+    return 0;
+}
+
+void aup_freeObject(aupObj *object)
+{
+    aup_deallocObject(object, aup_releaseObject(object));
 }
@@ -17,21 +17,29 @@ struct _aupObj {
 #else
             uintptr_t next;
 #endif
-            aupTObj type : 7;
-            unsigned isMarked : 1;
+            aupTObj type : 5;
+            unsigned isRemembered : 1;
+            unsigned isOld : 1;
 #ifdef AUP_X64
         };
     };
 #endif
 };
 
+// Short strings keep their bytes inline, [chars] points at
+// [bytes]. Longer ones own a buffer, borrowed ones point to
+// memory of the embedder. Always NUL terminated.
 struct _aupStr {
     aupObj base;
     char  *chars;
     int    length;
-    uint32_t hash; 
+    uint32_t hash;
+    bool   borrowed;
+    char   bytes[];
 };
 
+typedef struct _aupJit aupJit;
+
 struct _aupFun {
     aupObj base;
     aupStr *name;
@@ -40,6 +48,18 @@ struct _aupFun {
     int    upvalCount;
     aupChunk chunk;
     int    locals;
+    int    regs;
+
+    // Stack maps, the registers still live wherever a frame of
+    // the function can be stopped for the collector. Sorted by
+    // instruction offset, each map (regs + 63) / 64 words.
+    int       mapCount;
+    uint32_t *mapOffsets;
+    uint64_t *maps;
+
+#ifdef AUP_JIT
+    aupJit    *jit;         // NULL runs in the interpreter
+#endif
 };
 
 struct _aupUpv {
@@ -60,10 +80,39 @@ struct _aupInc {
     aupTab fields;
 };
 
+struct _aupNat {
+    aupObj base;
+    aupCFn fn;
+    aupStr *name;
+};
+
+struct _aupTsk {
+    aupObj base;
+    aupVM  *volatile vm;    // running routine, NULL once finished
+    aupVal result;
+    int    status;
+};
+
+// A string made by concatenation, neither hashed nor interned
+// until its bytes are needed as a string. Ropes extending the
+// end of a buffer share it, the one that made it owns it.
+struct _aupRop {
+    aupObj base;
+    aupRop *owner;          // NULL for the owner itself
+    char   *bytes;
+    int    length;
+    int    capacity;        // of the owner's buffer
+    volatile int used;      // of the owner's buffer
+    aupStr *flat;           // interned copy, once made
+};
+
 #define AUP_AsStr(v)    ((aupStr *)AUP_AsObj(v))
 #define AUP_AsCStr(v)   (AUP_AsStr(v)->chars)
 #define AUP_AsFun(v)    ((aupFun *)AUP_AsObj(v))
 #define AUP_AsClass(v)  ((aupKls *)AUP_AsObj(v))
+#define AUP_AsNat(v)    ((aupNat *)AUP_AsObj(v))
+#define AUP_AsTask(v)   ((aupTsk *)AUP_AsObj(v))
+#define AUP_AsRope(v)   ((aupRop *)AUP_AsObj(v))
 
 #define AUP_OType(v)    (AUP_AsObj(v)->type)
 
@@ -74,20 +123,42 @@ static inline bool AUP_CheckObj(aupVal val, aupTObj type) {
 #define AUP_IsStr(v)    (AUP_CheckObj(v, AUP_OSTR))
 #define AUP_IsFun(v)    (AUP_CheckObj(v, AUP_OFUN))
 #define AUP_IsClass(v)  (AUP_CheckObj(v, AUP_OKLS))
+#define AUP_IsNat(v)    (AUP_CheckObj(v, AUP_ONAT))
+#define AUP_IsTask(v)   (AUP_CheckObj(v, AUP_OTSK))
+#define AUP_IsRope(v)   (AUP_CheckObj(v, AUP_OROP))
+
+// Either form of a string, flat or rope.
+#define AUP_IsString(v) (AUP_IsStr(v) || AUP_IsRope(v))
+
+static inline const char *AUP_StrBytes(aupVal v, int *length) {
+    if (AUP_IsRope(v)) {
+        *length = AUP_AsRope(v)->length;
+        return AUP_AsRope(v)->bytes;
+    }
+    *length = AUP_AsStr(v)->length;
+    return AUP_AsStr(v)->chars;
+}
 
 void aup_printObject(aupObj *object);
+size_t aup_releaseObject(aupObj *object);
 void aup_freeObject(aupObj *object);
 
 aupStr *aup_takeString(char *chars, int length);
 aupStr *aup_copyString(const char *chars, int length);
 aupStr *aup_catString(aupStr *s1, aupStr *s2);
+aupStr *aup_borrowString(const char *chars, int length);
+aupRop *aup_concat(aupVal left, aupVal right);
+aupStr *aup_flatten(aupVal value);
 
 aupFun *aup_newFunction(aupSrc *source);
 void aup_makeClosure(aupFun *function);
+const uint64_t *aup_stackMap(aupFun *function, const uint32_t *ip);
 
 aupUpv *aup_newUpval(aupVal *slot);
 
 aupKls *aup_newClass(aupStr *name);
 aupInc *aup_newInstance(aupKls *klass);
+aupNat *aup_newNative(aupStr *name, aupCFn fn);
+aupTsk *aup_newTask();
 
 #endif
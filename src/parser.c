@@ -5,6 +5,9 @@
 
 #include "code.h"
 #include "object.h"
+#include "gc.h"
+#include "vm.h"
+#include "jit.h"
 
 #define MAX_ARGS    32
 #define MAX_LOCALS  244
@@ -89,8 +92,10 @@ struct _Compiler {
     int localCount;
     int scopeDepth;
     int localTotal;
+    int lastTarget;
 
     REG regCount;
+    REG regTotal;
 };
 
 #define VM          P.vm
@@ -100,7 +105,7 @@ struct _Compiler {
 #define CHUNK       getChunk()
 
 #define REG_COUNT   COMPILER->regCount
-#define PUSH()      (REG_COUNT++)
+#define PUSH()      pushReg()
 #define POP()       (--REG_COUNT)
 #define POP_N(n)    (REG_COUNT -= (n))
 #define PEEK(i)     (REG_COUNT - 1 - (i))
@@ -114,6 +119,15 @@ static aupChunk *getChunk()
     return &P.compiler->function->chunk;
 }
 
+static REG pushReg()
+{
+    REG reg = REG_COUNT++;
+    if (REG_COUNT > COMPILER->regTotal)
+        COMPILER->regTotal = REG_COUNT;
+
+    return reg;
+}
+
 static void errorAt(aupTok *token, const char *fmt, ...)
 {
     if (P.panicMode) return;
@@ -226,13 +240,67 @@ static void patchJump(int offset)
     // Patch the hole.
     i = AUP_OpAxxCx(op, jump, RK);
     chunk->code[offset] = i;
+
+    COMPILER->lastTarget = chunk->count;
+}
+
+// Emit a jump taken when [src] is falsey. If [src] was just produced by a
+// comparison from [start] on, that comparison is turned into a fused
+// compare-and-branch, the returned JMP still gets patched as usual.
+static int emitCondJump(REG src, int start)
+{
+    aupChunk *chunk = getChunk();
+    int last = chunk->count - 1;
+    bool expect = false;
+
+    // NOT after EQ, comes from '!='.
+    if (last - 1 >= start && AUP_GetOp(chunk->code[last]) == AUP_OP_NOT
+        && AUP_GetA(chunk->code[last]) == src && AUP_GetBx(chunk->code[last]) == src
+        && AUP_GetOp(chunk->code[last - 1]) == AUP_OP_EQ
+        && AUP_GetA(chunk->code[last - 1]) == src
+        && COMPILER->lastTarget < last) {
+        chunk->count--, last--;
+        expect = true;
+    }
+
+    if (last >= start && COMPILER->lastTarget <= last
+        && AUP_GetA(chunk->code[last]) == src) {
+        uint32_t i = chunk->code[last];
+        REG left = AUP_GetBx(i), right = AUP_GetCx(i);
+
+        switch (AUP_GetOp(i)) {
+            case AUP_OP_LT:
+                i = AUP_OpABxCx(AUP_OP_JLT, expect, left, right);
+                break;
+            case AUP_OP_LE:
+                i = AUP_OpABxCx(AUP_OP_JLE, expect, left, right);
+                break;
+            case AUP_OP_GT:
+                i = AUP_OpABxCx(AUP_OP_JLT, expect, right, left);
+                break;
+            case AUP_OP_GE:
+                i = AUP_OpABxCx(AUP_OP_JLE, expect, right, left);
+                break;
+            case AUP_OP_EQ:
+                i = AUP_OpABxCx(AUP_OP_JEQ, expect, left, right);
+                break;
+            default:
+                return emitJump(AUP_OP_JMPF, src);
+        }
+
+        chunk->code[last] = i;
+        return emitJump(AUP_OP_JMP, -1);
+    }
+
+    return emitJump(AUP_OP_JMPF, src);
 }
 
 static void emitReturn(REG src)
 {
     aupChunk *chunk = getChunk();
 
-    if (chunk->count == 0 || AUP_GetOp(chunk->code[chunk->count - 1]) != AUP_OP_RET) {
+    if (chunk->count == 0 || AUP_GetOp(chunk->code[chunk->count - 1]) != AUP_OP_RET
+        || COMPILER->lastTarget == chunk->count) {
         if (src == -1) {
             emit(AUP_OpA(AUP_OP_RET, false));
         }
@@ -242,9 +310,29 @@ static void emitReturn(REG src)
     }
 }
 
+// Turn a call emitted from [start] on, whose result is returned
+// as [src], into a tail call.
+static bool emitTailCall(REG src, int start)
+{
+    aupChunk *chunk = getChunk();
+    int last = chunk->count - 1;
+
+    if (last < start || COMPILER->lastTarget > last) return false;
+
+    uint32_t i = chunk->code[last];
+    if (AUP_GetOp(i) != AUP_OP_CALL || AUP_GetA(i) != src) return false;
+
+    chunk->code[last] = AUP_SetOp(i, AUP_OP_TAILCALL);
+    return true;
+}
+
 static uint8_t makeConstant(aupVal value)
 {
+    // The marker thread may be tracing the constants.
+    aup_lockHeap();
     int constant = aup_addConstant(getChunk(), value);
+    aup_unlockHeap();
+    AUP_WriteBarrier(COMPILER->function, value);
     if (constant > UINT8_MAX) {
         error("Too many constants in one chunk.");
         return 0;
@@ -266,14 +354,20 @@ static void initCompiler(Compiler *compiler, TFunc type)
     compiler->localCount = 0;
     compiler->scopeDepth = 0;
     compiler->localTotal = 0;
+    compiler->lastTarget = -1;
     compiler->function = aup_newFunction(P.source);
 
+    // Keep the function alive until it lands in the enclosing
+    // chunk, or in the VM once the script is compiled.
+    *VM->top++ = AUP_VObj(compiler->function);
+
     COMPILER = compiler;
     REG_COUNT = 0;
+    compiler->regTotal = 0;
 
     if (type != TYPE_SCRIPT) {
-        COMPILER->function->name = aup_copyString(
-            PREVIOUS.start, PREVIOUS.length);
+        AUP_SetObject(COMPILER->function, &COMPILER->function->name,
+            aup_copyString(PREVIOUS.start, PREVIOUS.length));
     }
 
     Local *local = &COMPILER->locals[COMPILER->localCount++];
@@ -286,18 +380,270 @@ static void initCompiler(Compiler *compiler, TFunc type)
     PUSH();
 }
 
+// Register sets of the stack map pass, one bit per register.
+#define MAP_WORDS   ((UINT8_COUNT + 63) / 64)
+
+typedef uint64_t RegSet[MAP_WORDS];
+
+static void addReg(RegSet set, int reg, int regs)
+{
+    if (reg >= 0 && reg < regs) set[reg / 64] |= (uint64_t)1 << (reg % 64);
+}
+
+static void removeReg(RegSet set, int reg)
+{
+    set[reg / 64] &= ~((uint64_t)1 << (reg % 64));
+}
+
+static void addRK(RegSet set, int reg, bool isK, int regs)
+{
+    if (!isK) addReg(set, reg, regs);
+}
+
+static void mergeInto(RegSet set, const uint64_t *from, int words)
+{
+    for (int i = 0; i < words; i++) set[i] |= from[i];
+}
+
+// Where control goes after the instruction at [pc].
+static int successors(aupChunk *chunk, int pc, int succ[2])
+{
+    uint32_t i = chunk->code[pc];
+    succ[0] = pc + 1;
+
+    switch (AUP_GetOp(i)) {
+        case AUP_OP_TAILCALL:
+        case AUP_OP_RET:
+            return 0;
+        case AUP_OP_JMP:
+            succ[0] = pc + 1 + AUP_GetAxx(i);
+            return 1;
+        case AUP_OP_JMPF:
+        case AUP_OP_JNE:
+            succ[1] = pc + 1 + AUP_GetAxx(i);
+            return 2;
+
+        // The following JMP only holds the offset.
+        case AUP_OP_JLT:
+        case AUP_OP_JLE:
+        case AUP_OP_JEQ:
+        case AUP_OP_JLT_NN:
+        case AUP_OP_JLE_NN:
+            succ[0] = pc + 2;
+            succ[1] = pc + 2 + AUP_GetAxx(chunk->code[pc + 1]);
+            return 2;
+
+        // Followed by a word per upvalue it captures.
+        case AUP_OP_OPEN:
+            succ[0] = pc + 1 +
+                AUP_AsFun(chunk->constants.values[AUP_GetA(i)])->upvalCount;
+            return 1;
+        default:
+            return 1;
+    }
+}
+
+// Turns the registers live after the instruction at [pc] into
+// the ones live before it.
+static void liveBefore(aupFun *function, int pc, RegSet set)
+{
+    aupChunk *chunk = &function->chunk;
+    uint32_t i = chunk->code[pc];
+    int regs = function->regs;
+    int a = AUP_GetA(i), b = AUP_GetB(i), c = AUP_GetC(i);
+
+    switch (AUP_GetOp(i)) {
+        case AUP_OP_PRI:
+            for (int r = a; r < a + b; r++) addReg(set, r, regs);
+            break;
+
+        case AUP_OP_NIL:
+        case AUP_OP_BOOL:
+        case AUP_OP_CLASS:
+        case AUP_OP_GLD:
+        case AUP_OP_ULD:
+            removeReg(set, a);
+            break;
+
+        case AUP_OP_CALL:
+        case AUP_OP_TAILCALL:
+            // The callee's window starts at A, whatever the caller
+            // had above its arguments does not survive the call.
+            for (int r = a; r < regs; r++) removeReg(set, r);
+            for (int r = a; r <= a + b; r++) addReg(set, r, regs);
+            break;
+
+        case AUP_OP_RET:
+            if (a) addRK(set, b, AUP_GetsB(i), regs);
+            break;
+
+        case AUP_OP_JMPF:
+        case AUP_OP_GST:
+            addRK(set, c, AUP_GetsC(i), regs);
+            break;
+        case AUP_OP_JNE:
+            addReg(set, c - 1, regs);
+            addReg(set, c, regs);
+            break;
+        case AUP_OP_JLT:
+        case AUP_OP_JLE:
+        case AUP_OP_JEQ:
+        case AUP_OP_JLT_NN:
+        case AUP_OP_JLE_NN:
+            addRK(set, b, AUP_GetsB(i), regs);
+            addRK(set, c, AUP_GetsC(i), regs);
+            break;
+
+        case AUP_OP_MOV:
+            removeReg(set, a);
+            addReg(set, b, regs);
+            break;
+        case AUP_OP_NOT:
+        case AUP_OP_NEG:
+        case AUP_OP_BNOT:
+        case AUP_OP_LD:
+            removeReg(set, a);
+            addRK(set, b, AUP_GetsB(i), regs);
+            break;
+        case AUP_OP_UST:
+            addRK(set, b, AUP_GetsB(i), regs);
+            break;
+
+        case AUP_OP_OPEN: {
+            int n = AUP_AsFun(chunk->constants.values[a])->upvalCount;
+            for (int k = 1; k <= n; k++) {
+                uint32_t capture = chunk->code[pc + k];
+                if (AUP_GetsB(capture)) addReg(set, AUP_GetA(capture), regs);
+            }
+            break;
+        }
+
+        case AUP_OP_JMP:
+        case AUP_OP_PSH:
+        case AUP_OP_POP:
+        case AUP_OP_CLOSE:
+        case AUP_OP_GET:
+        case AUP_OP_SET:
+            break;
+
+        default:
+            // The binary operators, R(A) = RK(B) op RK(C).
+            removeReg(set, a);
+            addRK(set, b, AUP_GetsB(i), regs);
+            addRK(set, c, AUP_GetsC(i), regs);
+            break;
+    }
+}
+
+// Where the collector can find a frame stopped: the entry, a
+// call and the instruction after it, the target of a backward
+// jump and the instructions that allocate or store to the heap.
+static bool isStop(aupChunk *chunk, int pc, const bool *target)
+{
+    if (pc == 0 || target[pc]) return true;
+
+    switch (AUP_GetOp(chunk->code[pc])) {
+        case AUP_OP_CALL:
+        case AUP_OP_TAILCALL:
+        case AUP_OP_CLASS:
+        case AUP_OP_ADD:
+        case AUP_OP_UST:
+        case AUP_OP_OPEN:
+        case AUP_OP_CLOSE:
+            return true;
+        default:
+            return AUP_GetOp(chunk->code[pc - 1]) == AUP_OP_CALL;
+    }
+}
+
+// Backward liveness over the whole chunk until it settles, then
+// keep the sets of the stops only.
+static void buildStackMaps(aupFun *function)
+{
+    aupChunk *chunk = &function->chunk;
+    int count = chunk->count;
+    int words = (function->regs + 63) / 64;
+
+    uint64_t *live = calloc((size_t)count * words, sizeof(uint64_t));
+    bool *data = calloc(count, sizeof(bool));
+    bool *target = calloc(count, sizeof(bool));
+
+    for (int pc = 0; pc < count; pc++) {
+        uint32_t i = chunk->code[pc];
+        if (data[pc]) continue;
+
+        if (AUP_GetOp(i) == AUP_OP_OPEN) {
+            int n = AUP_AsFun(chunk->constants.values[AUP_GetA(i)])->upvalCount;
+            for (int k = 1; k <= n; k++) data[pc + k] = true;
+        }
+        else if (AUP_GetOp(i) == AUP_OP_JMP && AUP_GetAxx(i) < 0) {
+            target[pc + 1 + AUP_GetAxx(i)] = true;
+        }
+    }
+
+    bool changed;
+    do {
+        changed = false;
+        for (int pc = count - 1; pc >= 0; pc--) {
+            if (data[pc]) continue;
+
+            RegSet set = { 0 };
+            int succ[2];
+            int n = successors(chunk, pc, succ);
+            for (int k = 0; k < n; k++) {
+                if (succ[k] < count) {
+                    mergeInto(set, live + (size_t)succ[k] * words, words);
+                }
+            }
+            liveBefore(function, pc, set);
+
+            uint64_t *old = live + (size_t)pc * words;
+            if (memcmp(old, set, sizeof(uint64_t) * words) != 0) {
+                memcpy(old, set, sizeof(uint64_t) * words);
+                changed = true;
+            }
+        }
+    } while (changed);
+
+    int stops = 0;
+    for (int pc = 0; pc < count; pc++) {
+        if (!data[pc] && isStop(chunk, pc, target)) stops++;
+    }
+
+    function->mapOffsets = malloc(sizeof(uint32_t) * stops);
+    function->maps = malloc(sizeof(uint64_t) * stops * words);
+    for (int pc = 0; pc < count; pc++) {
+        if (data[pc] || !isStop(chunk, pc, target)) continue;
+
+        int n = function->mapCount++;
+        function->mapOffsets[n] = (uint32_t)pc;
+        memcpy(function->maps + (size_t)n * words,
+            live + (size_t)pc * words, sizeof(uint64_t) * words);
+    }
+
+    free(live);
+    free(data);
+    free(target);
+}
+
 static aupFun *endCompiler()
 {
     emitReturn(-1);
     aupFun *function = COMPILER->function;
     function->locals = COMPILER->localTotal;
+    function->regs = COMPILER->regTotal;
 
     if (!P.hadError) {
+        buildStackMaps(function);
+#ifdef AUP_JIT
+        aup_jitCompile(function);
+#endif
         aup_dasmChunk(CHUNK,
             function->name != NULL ? function->name->chars : "<script>");
     }
    
     COMPILER = COMPILER->enclosing;
+    VM->top--;
     return function;
 }
 
@@ -337,6 +683,20 @@ static uint8_t identifierConstant(aupTok *name)
     return makeConstant(AUP_VObj(identifier));
 }
 
+static int globalSlot(aupTok *name)
+{
+    aupStr *identifier = aup_copyString(
+        name->start, name->length);
+
+    int slot = aup_globalSlot(identifier);
+    if (slot < 0) {
+        error("Too many global variables.");
+        return 0;
+    }
+
+    return slot;
+}
+
 static bool identifiersEqual(aupTok *a, aupTok *b)
 {
     if (a->length != b->length) return false;
@@ -434,14 +794,14 @@ static void declareVariable()
     addLocal(*name);
 }
 
-static uint8_t parseVariable(const char *errorMessage)
+static int parseVariable(const char *errorMessage)
 {
     consume(AUP_TOK_IDENTIFIER, errorMessage);
 
     declareVariable();
     if (COMPILER->scopeDepth > 0) return 0;
 
-    return identifierConstant(&PREVIOUS);
+    return globalSlot(&PREVIOUS);
 }
 
 static void markInitialized()
@@ -460,9 +820,9 @@ static void defineVariable(REG global, REG src)
     }
 
     if (src == -1)
-        emit(AUP_OpAsC(AUP_OP_GST, global, true));
-    else
-        emit(AUP_OpABx(AUP_OP_GST, global, src));
+        src = emitConstant(AUP_VNil);
+
+    emit(AUP_OpAxxCx(AUP_OP_GST, global, src));
 }
 
 static uint8_t argumentList()
@@ -702,21 +1062,27 @@ static REG namedVariable(aupTok name, REG dest, bool canAssign)
         storeOp = AUP_OP_UST;
     }
     else {
-        arg = identifierConstant(&name);
+        arg = globalSlot(&name);
         loadOp = AUP_OP_GLD;
         storeOp = AUP_OP_GST;
     }
 
     if (canAssign && match(AUP_TOK_EQUAL)) {
         REG src = exprEx(dest);
-        emit(AUP_OpABx(storeOp, arg, src));
+        if (storeOp == AUP_OP_GST)
+            emit(AUP_OpAxxCx(storeOp, arg, src));
+        else
+            emit(AUP_OpABx(storeOp, arg, src));
 
         dest = src;
         P.hadAssign = true;
     }
     else {
         if (isLocal) return arg;
-        emit(AUP_OpABx(loadOp, dest, arg));
+        if (loadOp == AUP_OP_GLD)
+            emit(AUP_OpABxx(loadOp, dest, arg));
+        else
+            emit(AUP_OpABx(loadOp, dest, arg));
     }
 
     return dest;
@@ -921,7 +1287,7 @@ static REG func(TFunc type)
             if (++COMPILER->function->arity > 255) {
                 errorAtCurrent("Cannot have more than 255 parameters.");
             }
-            uint8_t paramConstant = parseVariable("Expect parameter name.");
+            int paramConstant = parseVariable("Expect parameter name.");
             defineVariable(paramConstant, -1);
             PUSH();
         } while (match(AUP_TOK_COMMA));
@@ -957,11 +1323,12 @@ static void classDecl()
 
     consume(AUP_TOK_IDENTIFIER, "Expect class name.");
     uint8_t nameConstant = identifierConstant(&PREVIOUS);
+    int global = globalSlot(&PREVIOUS);
     declareVariable();
 
     REG klass = PUSH();
     emit(AUP_OpABx(AUP_OP_CLASS, klass, nameConstant));
-    defineVariable(nameConstant, klass);
+    defineVariable(global, klass);
 
     consume(AUP_TOK_LBRACE, "Expect '{' before class body.");
     consume(AUP_TOK_RBRACE, "Expect '}' after class body.");
@@ -975,7 +1342,7 @@ static void funcDecl()
         return;
     }
 
-    uint8_t global = parseVariable("Expect function name.");
+    int global = parseVariable("Expect function name.");
     markInitialized();
     REG src = func(TYPE_FUNCTION);
 
@@ -984,7 +1351,7 @@ static void funcDecl()
 
 static void varDecl()
 {
-    uint8_t global = parseVariable("Expect variable name.");
+    int global = parseVariable("Expect variable name.");
     REG src = -1;   // nil
 
     if (match(AUP_TOK_EQUAL)) {
@@ -1014,6 +1381,7 @@ static void exprStmt()
 
 static void ifStmt()
 {
+    int start = CHUNK->count;
     REG src = expr(-1);
 
     if (!match(AUP_TOK_KW_THEN) && !check(AUP_TOK_LBRACE)) {
@@ -1021,7 +1389,7 @@ static void ifStmt()
         return;
     }
 
-    int thenJump = emitJump(AUP_OP_JMPF, src);
+    int thenJump = emitCondJump(src, start);
     POP();
     stmt();
 
@@ -1061,8 +1429,11 @@ static void returnStmt()
         emitReturn(-1);
     }
     else {
+        int start = CHUNK->count;
         REG src = expr(-1);
-        emitReturn(src);
+        if (!emitTailCall(src, start)) {
+            emitReturn(src);
+        }
     }
 }
 
@@ -0,0 +1,309 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "sched.h"
+#include "thread.h"
+
+// Routines waiting for a thread. The owning worker pushes and
+// pops at the bottom, yielded routines and thieves use the top.
+typedef struct {
+    aupMutex lock;
+    aupVM  **slots;
+    int      head;
+    int      count;
+    int      space;
+} Deque;
+
+static struct {
+    bool      ready;
+    aupMutex  lock;
+    aupCond   wake;         // a routine was queued, or stopping
+    aupCond   done;         // a routine finished
+    int       queued;
+    int       pending;
+    unsigned  finished;
+    int       nextQueue;
+    bool      stopping;
+
+    aupThread *threads;
+    Deque     *deques;
+    int       workerCount;
+} m_sched;
+
+static THREAD_LOCAL int t_worker = -1;
+
+unsigned aup_finishedCount()
+{
+    aup_lock(&m_sched.lock);
+    unsigned finished = m_sched.finished;
+    aup_unlock(&m_sched.lock);
+    return finished;
+}
+
+void aup_waitFinished(unsigned seen)
+{
+    aup_lock(&m_sched.lock);
+    while (m_sched.finished == seen && m_sched.pending > 0) {
+        aup_wait(&m_sched.done, &m_sched.lock);
+    }
+    aup_unlock(&m_sched.lock);
+}
+
+static void pushDeque(Deque *deque, aupVM *vm, bool top)
+{
+    aup_lock(&deque->lock);
+
+    if (deque->count == deque->space) {
+        int space = AUP_GROW(deque->space);
+        aupVM **slots = malloc(sizeof(aupVM *) * space);
+        for (int i = 0; i < deque->count; i++) {
+            slots[i] = deque->slots[(deque->head + i) & (deque->space - 1)];
+        }
+
+        free(deque->slots);
+        deque->slots = slots;
+        deque->space = space;
+        deque->head = 0;
+    }
+
+    int mask = deque->space - 1;
+    if (top) {
+        deque->head = (deque->head - 1) & mask;
+        deque->slots[deque->head] = vm;
+    }
+    else {
+        deque->slots[(deque->head + deque->count) & mask] = vm;
+    }
+    deque->count++;
+
+    aup_unlock(&deque->lock);
+}
+
+static aupVM *popDeque(Deque *deque, bool top)
+{
+    aupVM *vm = NULL;
+    aup_lock(&deque->lock);
+
+    if (deque->count > 0) {
+        int mask = deque->space - 1;
+        deque->count--;
+        if (top) {
+            vm = deque->slots[deque->head];
+            deque->head = (deque->head + 1) & mask;
+        }
+        else {
+            vm = deque->slots[(deque->head + deque->count) & mask];
+        }
+    }
+
+    aup_unlock(&deque->lock);
+    return vm;
+}
+
+static void enqueue(aupVM *vm, bool top)
+{
+    int index = t_worker;
+    if (index < 0) {
+        index = m_sched.nextQueue++ % m_sched.workerCount;
+    }
+
+    pushDeque(&m_sched.deques[index], vm, top);
+
+    aup_lock(&m_sched.lock);
+    m_sched.queued++;
+    aup_signal(&m_sched.wake);
+    aup_unlock(&m_sched.lock);
+}
+
+// Own deque first, then steal from the others.
+static aupVM *dequeue(int self)
+{
+    aupVM *vm = popDeque(&m_sched.deques[self], false);
+
+    for (int i = 1; vm == NULL && i < m_sched.workerCount; i++) {
+        vm = popDeque(&m_sched.deques[(self + i) % m_sched.workerCount], true);
+    }
+
+    if (vm != NULL) {
+        aup_lock(&m_sched.lock);
+        m_sched.queued--;
+        aup_unlock(&m_sched.lock);
+    }
+
+    return vm;
+}
+
+// Called from inside the heap.
+static void finish(aupVM *vm, int status)
+{
+    aupTsk *task = vm->task;
+    task->status = status;
+    AUP_SetValue(task, &task->result,
+        (status == AUP_OK) ? vm->stack[0] : AUP_VNil);
+    // Publishes the result to joiners.
+    AUP_AtomicStore(&task->vm, NULL);
+
+    aup_closeVM(vm);
+}
+
+static void worker(void *arg)
+{
+    int self = (int)(intptr_t)arg;
+    t_worker = self;
+
+    for (;;) {
+        aupVM *vm = dequeue(self);
+
+        if (vm == NULL) {
+            aup_lock(&m_sched.lock);
+            while (m_sched.queued == 0 && !m_sched.stopping) {
+                aup_wait(&m_sched.wake, &m_sched.lock);
+            }
+            bool stop = (m_sched.queued == 0);
+            aup_unlock(&m_sched.lock);
+
+            if (stop) break;
+            continue;
+        }
+
+        aup_enterHeap();
+        int status = aup_resume(vm);
+
+        if (status == AUP_YIELD) {
+            aup_leaveHeap();
+            enqueue(vm, true);
+            continue;
+        }
+
+        finish(vm, status);
+        aup_leaveHeap();
+
+        aup_lock(&m_sched.lock);
+        m_sched.pending--;
+        m_sched.finished++;
+        aup_broadcast(&m_sched.done);
+        aup_unlock(&m_sched.lock);
+    }
+}
+
+static void startWorkers()
+{
+    int count = aup_cpuCount();
+
+    m_sched.threads = malloc(sizeof(aupThread) * count);
+    m_sched.deques = malloc(sizeof(Deque) * count);
+    memset(m_sched.deques, '\0', sizeof(Deque) * count);
+
+    for (int i = 0; i < count; i++) {
+        aup_initMutex(&m_sched.deques[i].lock);
+    }
+
+    m_sched.workerCount = count;
+    m_sched.stopping = false;
+
+    for (int i = 0; i < count; i++) {
+        aup_startThread(&m_sched.threads[i], worker, (void *)(intptr_t)i);
+    }
+}
+
+void aup_stopSched()
+{
+    if (m_sched.workerCount == 0) return;
+
+    aup_lock(&m_sched.lock);
+    while (m_sched.pending > 0) {
+        aup_wait(&m_sched.done, &m_sched.lock);
+    }
+    m_sched.stopping = true;
+    aup_broadcast(&m_sched.wake);
+    aup_unlock(&m_sched.lock);
+
+    for (int i = 0; i < m_sched.workerCount; i++) {
+        aup_joinThread(m_sched.threads[i]);
+    }
+
+    for (int i = 0; i < m_sched.workerCount; i++) {
+        aup_freeMutex(&m_sched.deques[i].lock);
+        free(m_sched.deques[i].slots);
+    }
+
+    free(m_sched.threads);
+    free(m_sched.deques);
+    m_sched.threads = NULL;
+    m_sched.deques = NULL;
+    m_sched.workerCount = 0;
+}
+
+aupTsk *aup_spawn(aupVM *from, aupVal callee, int argc, aupVal *args)
+{
+    if (m_sched.workerCount == 0) {
+        startWorkers();
+    }
+
+    aupTsk *task = aup_newTask();
+    AUP_PushRoot(from, (aupObj *)task);
+
+    aupVM *vm = aup_createVM(from);
+    vm->task = task;
+    AUP_PopRoot(from);
+
+    if (!aup_prepare(vm, callee, argc, args)) {
+        task->status = AUP_RUNTIME_ERROR;
+        aup_closeVM(vm);
+        return task;
+    }
+
+    task->vm = vm;
+
+    aup_lock(&m_sched.lock);
+    m_sched.pending++;
+    aup_unlock(&m_sched.lock);
+
+    enqueue(vm, false);
+    return task;
+}
+
+// spawn(fn, ...) -> task
+static aupVal spawnNative(aupVM *vm, int argc, aupVal *args)
+{
+    if (argc < 1) return AUP_VNil;
+
+    aupTsk *task = aup_spawn(vm, args[0], argc - 1, args + 1);
+    return AUP_VObj(task);
+}
+
+// join(task) -> result, blocks until the task finished.
+static aupVal joinNative(aupVM *vm, int argc, aupVal *args)
+{
+    if (argc < 1 || !AUP_IsTask(args[0])) return AUP_VNil;
+
+    aupTsk *task = AUP_AsTask(args[0]);
+    if (AUP_AtomicLoad(&task->vm) != NULL) {
+        aup_block(vm);
+        return AUP_VNil;
+    }
+
+    return task->result;
+}
+
+// yield()
+static aupVal yieldNative(aupVM *vm, int argc, aupVal *args)
+{
+    (void)argc, (void)args;
+    aup_yield(vm);
+    return AUP_VNil;
+}
+
+void aup_initSched(aupVM *vm)
+{
+    if (!m_sched.ready) {
+        aup_initMutex(&m_sched.lock);
+        aup_initCond(&m_sched.wake);
+        aup_initCond(&m_sched.done);
+        m_sched.ready = true;
+    }
+
+    aup_defineNative(vm, "spawn", spawnNative);
+    aup_defineNative(vm, "join", joinNative);
+    aup_defineNative(vm, "yield", yieldNative);
+}
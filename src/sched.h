@@ -0,0 +1,16 @@
+#ifndef _AUP_SCHED_H
+#define _AUP_SCHED_H
+#pragma once
+
+#include "vm.h"
+
+void aup_initSched(aupVM *vm);
+void aup_stopSched();
+
+// Routines finished so far, and a wait for that to change.
+unsigned aup_finishedCount();
+void aup_waitFinished(unsigned seen);
+
+aupTsk *aup_spawn(aupVM *from, aupVal callee, int argc, aupVal *args);
+
+#endif
@@ -0,0 +1,558 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "slab.h"
+
+#ifdef AUP_WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS   MAP_ANON
+#endif
+#endif
+
+// Classes run from 16 bytes, the smallest object, up to
+// AUP_SLAB_MAX. Large objects have a class of their own.
+#define CLASS_COUNT     AUP_SLAB_CLASSES
+#define CLASS_OF(size)  ((size) <= 16 ? 0 : ((size) + 7) / 8 - 2)
+#define SLOT_SIZE(c)    (((c) + 2) * 8)
+#define LARGE           CLASS_COUNT
+
+#define BITMAP_WORDS    (AUP_SLAB_PAGE / 16 / 64)
+
+#define PAGE_OF(ptr) \
+    ((Page *)((uintptr_t)(ptr) & ~(uintptr_t)(AUP_SLAB_PAGE - 1)))
+
+typedef struct _Slot {
+    struct _Slot *next;
+} Slot;
+
+// Sits at the start of its page, the slots follow.
+typedef struct _Page {
+    struct _Page *next;
+    struct _Page *prev;
+    struct _Page **list;    // head of the list the page is on
+    Slot  *free;            // slots given back
+    char  *bump;            // slots never handed out start here
+    size_t mapSize;
+    int    used;
+    int    capacity;
+    int    slotSize;
+    int    sizeClass;
+    bool   unswept;
+    bool   evacuated;       // objects moved out, new addresses left
+    uint64_t live[BITMAP_WORDS];
+    uint64_t marks[BITMAP_WORDS];
+} Page;
+
+#define HEADER_SIZE     ((sizeof(Page) + 15) & ~(size_t)15)
+#define FIRST_SLOT(page) \
+    ((char *)(page) + HEADER_SIZE)
+#define SLOT_INDEX(page, ptr) \
+    (int)(((char *)(ptr) - FIRST_SLOT(page)) / (page)->slotSize)
+
+static struct {
+    Page  *partial[CLASS_COUNT + 1];    // swept, with a free slot
+    Page  *full[CLASS_COUNT + 1];       // swept, no free slot
+    Page  *unswept[CLASS_COUNT + 1];    // marked by the last cycle
+    Page  *evacuated;                   // emptied by a compaction
+    int    sweepClass;
+    size_t pageCount;
+    aupFinalizer finalize;
+} m_slab;
+
+// Pages come straight from the OS, aligned to the page size
+// so an object finds its page by masking its address.
+static void *mapPage(size_t size)
+{
+#ifdef AUP_WIN32
+    // Allocations are aligned to 64K already.
+    return VirtualAlloc(NULL, size,
+        MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+#else
+    size_t mapped = size + AUP_SLAB_PAGE;
+    char *base = mmap(NULL, mapped, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) return NULL;
+
+    char *page = (char *)(((uintptr_t)base + AUP_SLAB_PAGE - 1)
+        & ~(uintptr_t)(AUP_SLAB_PAGE - 1));
+    if (page > base) munmap(base, page - base);
+    munmap(page + size, base + mapped - (page + size));
+    return page;
+#endif
+}
+
+static void unmapPage(Page *page)
+{
+    m_slab.pageCount--;
+#ifdef AUP_WIN32
+    VirtualFree(page, 0, MEM_RELEASE);
+#else
+    munmap(page, page->mapSize);
+#endif
+}
+
+static void linkPage(Page *page, Page **list)
+{
+    page->list = list;
+    page->prev = NULL;
+    page->next = *list;
+    if (*list != NULL) (*list)->prev = page;
+    *list = page;
+}
+
+static void unlinkPage(Page *page)
+{
+    if (page->prev != NULL)
+        page->prev->next = page->next;
+    else
+        *page->list = page->next;
+
+    if (page->next != NULL) page->next->prev = page->prev;
+    page->next = page->prev = NULL;
+    page->list = NULL;
+}
+
+static Page *newPage(int sizeClass, size_t mapSize, int slotSize)
+{
+    Page *page = mapPage(mapSize);
+    if (page == NULL) return NULL;
+
+    // Fresh mappings are zeroed, bitmaps included.
+    char *first = FIRST_SLOT(page);
+    page->free = NULL;
+    page->bump = first;
+    page->mapSize = mapSize;
+    page->used = 0;
+    page->slotSize = slotSize;
+    page->capacity = (sizeClass == LARGE) ? 1 :
+        (int)(((char *)page + mapSize - first) / slotSize);
+    page->sizeClass = sizeClass;
+    page->unswept = false;
+    page->evacuated = false;
+
+    m_slab.pageCount++;
+    return page;
+}
+
+static int lowestBit(uint64_t bits)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(bits);
+#else
+    int n = 0;
+    while (!(bits & 1)) {
+        bits >>= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+// Puts a swept page on the list matching its use. An empty one
+// goes back to the OS, unless it is the last of its class.
+static void placePage(Page *page)
+{
+    int sizeClass = page->sizeClass;
+
+    if (page->used == 0 &&
+        (sizeClass == LARGE || m_slab.partial[sizeClass] != NULL)) {
+        unmapPage(page);
+    }
+    else if (page->used < page->capacity) {
+        linkPage(page, &m_slab.partial[sizeClass]);
+    }
+    else {
+        linkPage(page, &m_slab.full[sizeClass]);
+    }
+}
+
+// Frees the objects on [page] the last cycle left unmarked by
+// scanning its bitmaps, returns the objects it held.
+static int sweepPage(Page *page)
+{
+    int held = page->used;
+    int words = (page->capacity + 63) / 64;
+
+    unlinkPage(page);
+
+    for (int i = 0; i < words; i++) {
+        uint64_t dead = page->live[i] & ~page->marks[i];
+
+        while (dead != 0) {
+            int bit = lowestBit(dead);
+            dead &= dead - 1;
+
+            Slot *slot = (Slot *)(FIRST_SLOT(page) +
+                (size_t)(i * 64 + bit) * page->slotSize);
+            m_slab.finalize(slot);
+            slot->next = page->free;
+            page->free = slot;
+            page->used--;
+        }
+
+        page->live[i] &= page->marks[i];
+        page->marks[i] = 0;
+    }
+
+    page->unswept = false;
+    placePage(page);
+    return held;
+}
+
+void aup_initSlabs(aupFinalizer finalize)
+{
+    memset(&m_slab, '\0', sizeof(m_slab));
+    m_slab.finalize = finalize;
+}
+
+static void freeList(Page **list)
+{
+    while (*list != NULL) {
+        Page *page = *list;
+        int words = (page->capacity + 63) / 64;
+
+        for (int i = 0; i < words; i++) {
+            for (uint64_t live = page->live[i]; live != 0; live &= live - 1) {
+                m_slab.finalize(FIRST_SLOT(page) +
+                    (size_t)(i * 64 + lowestBit(live)) * page->slotSize);
+            }
+        }
+
+        unlinkPage(page);
+        unmapPage(page);
+    }
+}
+
+// Finalizes every object left.
+void aup_freeSlabs()
+{
+    for (int i = 0; i <= CLASS_COUNT; i++) {
+        freeList(&m_slab.partial[i]);
+        freeList(&m_slab.full[i]);
+        freeList(&m_slab.unswept[i]);
+    }
+}
+
+// A page of [sizeClass] with a free slot, on the partial list.
+static Page *partialPage(int sizeClass)
+{
+    Page *page = m_slab.partial[sizeClass];
+
+    // Pages the last cycle marked are swept before a new one
+    // is taken.
+    while (page == NULL && m_slab.unswept[sizeClass] != NULL) {
+        sweepPage(m_slab.unswept[sizeClass]);
+        page = m_slab.partial[sizeClass];
+    }
+
+    if (page == NULL) {
+        page = newPage(sizeClass, AUP_SLAB_PAGE, SLOT_SIZE(sizeClass));
+        if (page == NULL) return NULL;
+        linkPage(page, &m_slab.partial[sizeClass]);
+    }
+
+    return page;
+}
+
+static void *takeSlot(Page *page)
+{
+    char *slot;
+    if (page->free != NULL) {
+        slot = (char *)page->free;
+        page->free = page->free->next;
+    }
+    else {
+        slot = page->bump;
+        page->bump += page->slotSize;
+    }
+
+    int index = SLOT_INDEX(page, slot);
+    page->live[index >> 6] |= (uint64_t)1 << (index & 63);
+    page->used++;
+
+    return slot;
+}
+
+void *aup_slabAlloc(size_t size)
+{
+    Page *page;
+    int sizeClass;
+
+    if (size > AUP_SLAB_MAX) {
+        size_t mapSize = (HEADER_SIZE + size + AUP_SLAB_PAGE - 1)
+            & ~(size_t)(AUP_SLAB_PAGE - 1);
+        sizeClass = LARGE;
+        page = newPage(LARGE, mapSize, (int)size);
+        if (page == NULL) return NULL;
+        linkPage(page, &m_slab.partial[LARGE]);
+    }
+    else {
+        sizeClass = CLASS_OF(size);
+        page = partialPage(sizeClass);
+        if (page == NULL) return NULL;
+    }
+
+    void *slot = takeSlot(page);
+
+    if (page->used == page->capacity) {
+        unlinkPage(page);
+        linkPage(page, &m_slab.full[sizeClass]);
+    }
+
+    return slot;
+}
+
+void *aup_slabCacheAlloc(aupSlabCache *cache, size_t size)
+{
+    if (size > AUP_SLAB_MAX) return NULL;
+
+    Page *page = cache->pages[CLASS_OF(size)];
+    if (page == NULL || page->used == page->capacity) return NULL;
+
+    return takeSlot(page);
+}
+
+// Swaps the cached page of the class for one with free slots,
+// owned pages are on no list.
+bool aup_slabRefill(aupSlabCache *cache, size_t size)
+{
+    if (size > AUP_SLAB_MAX) return false;
+
+    int sizeClass = CLASS_OF(size);
+    if (cache->pages[sizeClass] != NULL) {
+        placePage(cache->pages[sizeClass]);
+        cache->pages[sizeClass] = NULL;
+    }
+
+    Page *page = partialPage(sizeClass);
+    if (page == NULL) return false;
+
+    unlinkPage(page);
+    cache->pages[sizeClass] = page;
+    return true;
+}
+
+void aup_slabFlush(aupSlabCache *cache)
+{
+    for (int i = 0; i < CLASS_COUNT; i++) {
+        if (cache->pages[i] != NULL) {
+            placePage(cache->pages[i]);
+            cache->pages[i] = NULL;
+        }
+    }
+}
+
+void aup_slabFree(void *ptr)
+{
+    Page *page = PAGE_OF(ptr);
+    Slot *slot = (Slot *)ptr;
+
+    int index = SLOT_INDEX(page, ptr);
+    page->live[index >> 6] &= ~((uint64_t)1 << (index & 63));
+    page->marks[index >> 6] &= ~((uint64_t)1 << (index & 63));
+
+    slot->next = page->free;
+    page->free = slot;
+    page->used--;
+
+    // A page waiting for its sweep is placed by it.
+    if (!page->unswept) {
+        unlinkPage(page);
+        placePage(page);
+    }
+}
+
+bool aup_slabMark(void *ptr)
+{
+    Page *page = PAGE_OF(ptr);
+    int index = SLOT_INDEX(page, ptr);
+    uint64_t bit = (uint64_t)1 << (index & 63);
+
+    if (page->marks[index >> 6] & bit) return false;
+    page->marks[index >> 6] |= bit;
+    return true;
+}
+
+// For several threads marking at once, returns true if this
+// one set the bit.
+bool aup_slabMarkAtomic(void *ptr)
+{
+    Page *page = PAGE_OF(ptr);
+    int index = SLOT_INDEX(page, ptr);
+    uint64_t bit = (uint64_t)1 << (index & 63);
+    uint64_t *word = &page->marks[index >> 6];
+
+    if (AUP_AtomicLoad(word) & bit) return false;
+    return !(AUP_AtomicOr64(word, bit) & bit);
+}
+
+bool aup_slabIsMarked(void *ptr)
+{
+    Page *page = PAGE_OF(ptr);
+    int index = SLOT_INDEX(page, ptr);
+    return (page->marks[index >> 6] >> (index & 63)) & 1;
+}
+
+void aup_slabUnmark(void *ptr)
+{
+    Page *page = PAGE_OF(ptr);
+    int index = SLOT_INDEX(page, ptr);
+    page->marks[index >> 6] &= ~((uint64_t)1 << (index & 63));
+}
+
+static void moveUnswept(Page **list, int sizeClass)
+{
+    while (*list != NULL) {
+        Page *page = *list;
+        unlinkPage(page);
+        page->unswept = true;
+        linkPage(page, &m_slab.unswept[sizeClass]);
+    }
+}
+
+void aup_slabStartSweep()
+{
+    for (int i = 0; i <= CLASS_COUNT; i++) {
+        moveUnswept(&m_slab.partial[i], i);
+        moveUnswept(&m_slab.full[i], i);
+    }
+    m_slab.sweepClass = 0;
+}
+
+// Sweeps one page left by the last cycle, returns the objects
+// it held, or -1 once every page is swept.
+int aup_slabSweepOne()
+{
+    for (; m_slab.sweepClass <= CLASS_COUNT; m_slab.sweepClass++) {
+        Page *page = m_slab.unswept[m_slab.sweepClass];
+        if (page != NULL) return sweepPage(page);
+    }
+    return -1;
+}
+
+// Pages worth moving objects out of, at most half used and
+// with no object pinned by a mark.
+static bool isSparse(Page *page)
+{
+    if (page->used * 2 > page->capacity) return false;
+
+    for (int i = 0; i < BITMAP_WORDS; i++) {
+        if (page->marks[i] != 0) return false;
+    }
+    return true;
+}
+
+// Pages a compaction of [sizeClass] would give back.
+static int spareOf(int sizeClass)
+{
+    int count = 0, used = 0, capacity = 0;
+
+    for (Page *page = m_slab.partial[sizeClass]; page != NULL; page = page->next) {
+        if (!isSparse(page)) continue;
+        count++;
+        used += page->used;
+        capacity = page->capacity;
+    }
+
+    return (count < 2) ? 0 : count - (used + capacity - 1) / capacity;
+}
+
+size_t aup_slabSparePages()
+{
+    size_t spare = 0;
+    for (int i = 0; i < CLASS_COUNT; i++) {
+        spare += spareOf(i);
+    }
+    return spare;
+}
+
+size_t aup_slabEvacuate(aupMover moved)
+{
+    size_t count = 0;
+
+    for (int i = 0; i < CLASS_COUNT; i++) {
+        if (spareOf(i) == 0) continue;
+
+        // Taken off the partial list first, so the copies go to
+        // the other pages of the class.
+        Page *sparse = NULL;
+        for (Page *page = m_slab.partial[i], *next; page != NULL; page = next) {
+            next = page->next;
+            if (!isSparse(page)) continue;
+            unlinkPage(page);
+            linkPage(page, &sparse);
+        }
+
+        while (sparse != NULL) {
+            Page *page = sparse;
+            int words = (page->capacity + 63) / 64;
+
+            for (int j = 0; j < words; j++) {
+                for (uint64_t live = page->live[j]; live != 0; live &= live - 1) {
+                    char *from = FIRST_SLOT(page) +
+                        (size_t)(j * 64 + lowestBit(live)) * page->slotSize;
+                    void *to = aup_slabAlloc(page->slotSize);
+
+                    memcpy(to, from, page->slotSize);
+                    moved(from, to);
+                    *(void **)from = to;
+                    count++;
+                }
+            }
+
+            page->evacuated = true;
+            unlinkPage(page);
+            linkPage(page, &m_slab.evacuated);
+        }
+    }
+
+    return count;
+}
+
+void *aup_slabForward(void *ptr)
+{
+    Page *page = PAGE_OF(ptr);
+    return page->evacuated ? *(void **)ptr : ptr;
+}
+
+static void eachIn(Page *list, void (* visit)(void *object))
+{
+    for (Page *page = list; page != NULL; page = page->next) {
+        int words = (page->capacity + 63) / 64;
+
+        for (int i = 0; i < words; i++) {
+            for (uint64_t live = page->live[i]; live != 0; live &= live - 1) {
+                visit(FIRST_SLOT(page) +
+                    (size_t)(i * 64 + lowestBit(live)) * page->slotSize);
+            }
+        }
+    }
+}
+
+void aup_slabEach(void (* visit)(void *object))
+{
+    for (int i = 0; i <= CLASS_COUNT; i++) {
+        eachIn(m_slab.partial[i], visit);
+        eachIn(m_slab.full[i], visit);
+        eachIn(m_slab.unswept[i], visit);
+    }
+}
+
+// The objects moved out live on in their copies, nothing is
+// finalized.
+void aup_slabFreeEvacuated()
+{
+    while (m_slab.evacuated != NULL) {
+        Page *page = m_slab.evacuated;
+        unlinkPage(page);
+        unmapPage(page);
+    }
+}
+
+size_t aup_slabPages()
+{
+    return m_slab.pageCount;
+}
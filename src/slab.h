@@ -0,0 +1,67 @@
+#ifndef _AUP_SLAB_H
+#define _AUP_SLAB_H
+#pragma once
+
+#include "util.h"
+
+// Objects up to this size share slab pages, one size class
+// per 8 bytes. A larger one gets a page of its own.
+#define AUP_SLAB_MAX        128
+
+// Size and alignment of a slab page.
+#define AUP_SLAB_PAGE       (64 * 1024)
+
+// Size classes, from 16 bytes up to AUP_SLAB_MAX.
+#define AUP_SLAB_CLASSES    (AUP_SLAB_MAX / 8 - 1)
+
+// Called for every object a sweep frees, before its slot is
+// reused.
+typedef void (* aupFinalizer)(void *object);
+
+// Called for every object a compaction moves, once copied.
+typedef void (* aupMover)(void *from, void *to);
+
+// Not thread safe, the heap lock guards the slabs.
+void aup_initSlabs(aupFinalizer finalize);
+void aup_freeSlabs();
+
+void *aup_slabAlloc(size_t size);
+void aup_slabFree(void *ptr);
+
+// A page per size class owned by one thread, which allocates
+// from it without the heap lock. Refilling and flushing need
+// the lock, the cache must be flushed before anything else
+// looks at the slabs.
+typedef struct {
+    void *pages[AUP_SLAB_CLASSES];
+} aupSlabCache;
+
+void *aup_slabCacheAlloc(aupSlabCache *cache, size_t size);
+bool aup_slabRefill(aupSlabCache *cache, size_t size);
+void aup_slabFlush(aupSlabCache *cache);
+
+// Mark bits live in a bitmap on the object's page.
+bool aup_slabMark(void *ptr);
+bool aup_slabMarkAtomic(void *ptr);
+bool aup_slabIsMarked(void *ptr);
+void aup_slabUnmark(void *ptr);
+
+// Once marking is done every page is left to be swept, either
+// before the next allocation into it or one by one.
+void aup_slabStartSweep();
+int  aup_slabSweepOne();
+
+// Compaction. Sparse pages of a size class are emptied into
+// the others, an evacuated object leaves its new address
+// behind until the evacuated pages are freed. Only valid
+// with every page swept.
+size_t aup_slabSparePages();
+size_t aup_slabEvacuate(aupMover moved);
+void *aup_slabForward(void *ptr);
+void aup_slabEach(void (* visit)(void *object));
+void aup_slabFreeEvacuated();
+
+// Pages currently mapped.
+size_t aup_slabPages();
+
+#endif
@@ -0,0 +1,3964 @@
+// Generated by tools/stencils.py from tools/stencils.c, do not edit.
+
+#ifndef _AUP_STENCILS_H
+#define _AUP_STENCILS_H
+#pragma once
+
+typedef enum {
+    AUP_STENCIL_EXIT,
+    AUP_STENCIL_NOP,
+    AUP_STENCIL_NIL,
+    AUP_STENCIL_BOOL,
+    AUP_STENCIL_JMPF,
+    AUP_STENCIL_JNE,
+    AUP_STENCIL_JLT,
+    AUP_STENCIL_JLE,
+    AUP_STENCIL_JEQ,
+    AUP_STENCIL_NOT,
+    AUP_STENCIL_LT,
+    AUP_STENCIL_LE,
+    AUP_STENCIL_GT,
+    AUP_STENCIL_GE,
+    AUP_STENCIL_EQ,
+    AUP_STENCIL_NEG,
+    AUP_STENCIL_ADD,
+    AUP_STENCIL_SUB,
+    AUP_STENCIL_MUL,
+    AUP_STENCIL_DIV,
+    AUP_STENCIL_MOD,
+    AUP_STENCIL_POW,
+    AUP_STENCIL_BNOT,
+    AUP_STENCIL_BAND,
+    AUP_STENCIL_BOR,
+    AUP_STENCIL_BXOR,
+    AUP_STENCIL_SHL,
+    AUP_STENCIL_SHR,
+    AUP_STENCIL_MOV,
+    AUP_STENCIL_LD,
+    AUP_STENCIL_GLD,
+    AUP_STENCIL_GST,
+    AUP_STENCIL_COUNT
+} aupStencilKind;
+
+#ifdef AUP_NAN_BOXING
+
+static const uint8_t aup_stencilCode0[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles0[] = {
+    { 2, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode1[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles1[] = {
+    { 2, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode2[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x89, 0x14, 0x07,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles2[] = {
+    { 2, AUP_HOLE_RA, NULL, 0 },
+    { 26, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode3[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xf8, 0x01,
+    0x48, 0xb8, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x83,
+    0xd8, 0xff, 0x48, 0x89, 0x04, 0x17, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles3[] = {
+    { 2, AUP_HOLE_IMM, NULL, 0 },
+    { 12, AUP_HOLE_RA, NULL, 0 },
+    { 44, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode4[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x8b, 0x04, 0x07,
+    0x48, 0x89, 0xc1, 0x48, 0x21, 0xd1, 0x48, 0x39, 0xd1, 0x74, 0x1d, 0x66,
+    0x48, 0x0f, 0x6e, 0xc8, 0x66, 0x0f, 0xef, 0xc0, 0x66, 0x0f, 0x2e, 0xc8,
+    0x7a, 0x21, 0x75, 0x1f, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xe0, 0x48, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x03, 0x80, 0x48, 0x01, 0xd0, 0x48, 0x83, 0xf8, 0x01, 0x76, 0xe1, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles4[] = {
+    { 2, AUP_HOLE_RC, NULL, 0 },
+    { 54, AUP_HOLE_TARGET, NULL, 0 },
+    { 85, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode5[] = {
+    0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x89, 0xc1, 0x48,
+    0x21, 0xd1, 0x48, 0x39, 0xd1, 0x74, 0x21, 0x66, 0x48, 0x0f, 0x6e, 0xc8,
+    0x66, 0x0f, 0xef, 0xc0, 0x66, 0x0f, 0x2e, 0xc8, 0x7a, 0x25, 0x75, 0x23,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+    0x0f, 0x1f, 0x40, 0x00, 0x48, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x03, 0x80, 0x48, 0x01, 0xd0, 0x48, 0x83, 0xf8, 0x01, 0x76, 0xdd, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles5[] = {
+    { 2, AUP_HOLE_KC, NULL, 0 },
+    { 50, AUP_HOLE_TARGET, NULL, 0 },
+    { 85, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode6[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x48,
+    0x89, 0xfb, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x01, 0xfa, 0x48, 0x01, 0xf8, 0x48, 0x8b, 0x0a, 0x48, 0x3b, 0x08,
+    0x74, 0x71, 0x48, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff,
+    0x48, 0x89, 0xcf, 0x48, 0x21, 0xf7, 0x48, 0x39, 0xf7, 0x74, 0x75, 0x48,
+    0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0x48, 0x8b, 0x08,
+    0x48, 0x89, 0xcf, 0x48, 0x21, 0xf7, 0x48, 0x39, 0xf7, 0x74, 0x15, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xdf,
+    0x5b, 0xff, 0xe0, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0xbe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x48, 0x21, 0xf1, 0x0f, 0xb6, 0x49,
+    0x07, 0x83, 0xe1, 0x1f, 0x80, 0xf9, 0x07, 0x75, 0xd2, 0x48, 0x8b, 0x30,
+    0x48, 0x8b, 0x3a, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xd0, 0x84, 0xc0, 0x74, 0xbc, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xdf, 0x5b, 0xff, 0xe0, 0x66,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xbe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x48, 0x21, 0xf1, 0x0f, 0xb6, 0x49,
+    0x07, 0x83, 0xe1, 0x1f, 0x80, 0xf9, 0x07, 0x0f, 0x85, 0x6e, 0xff, 0xff,
+    0xff, 0xeb, 0xb2,
+};
+static const aupHole aup_stencilHoles6[] = {
+    { 2, AUP_HOLE_RC, NULL, 0 },
+    { 16, AUP_HOLE_RB, NULL, 0 },
+    { 85, AUP_HOLE_TARGET, NULL, 0 },
+    { 137, AUP_HOLE_SYM, (const void *)&aup_isEqual, 0 },
+    { 153, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode7[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x0c, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x8d, 0x14, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x7f, 0x48, 0x89, 0xce, 0x48, 0x21, 0xc6, 0x48, 0x39, 0xc6, 0x74,
+    0x57, 0x48, 0x8b, 0x12, 0x48, 0x89, 0xd6, 0x48, 0x21, 0xc6, 0x48, 0x39,
+    0xc6, 0x74, 0x49, 0x66, 0x48, 0x0f, 0x6e, 0xc2, 0x66, 0x48, 0x0f, 0x6e,
+    0xc9, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66,
+    0x0f, 0x2f, 0xc1, 0x77, 0x17, 0x48, 0x85, 0xc0, 0x75, 0x18, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0x83, 0xf8, 0x01, 0x74, 0xe8, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles7[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 16, AUP_HOLE_RC, NULL, 0 },
+    { 75, AUP_HOLE_IMM, NULL, 0 },
+    { 96, AUP_HOLE_TARGET, NULL, 0 },
+    { 120, AUP_HOLE_NEXT, NULL, 0 },
+    { 138, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode8[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x8b, 0x0c, 0x07,
+    0x48, 0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x5d, 0x48,
+    0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6,
+    0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x48, 0x66, 0x48, 0x0f, 0x6e,
+    0xc0, 0x66, 0x48, 0x0f, 0x6e, 0xc9, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x66, 0x0f, 0x2f, 0xc1, 0x77, 0x16, 0x48, 0x85,
+    0xc0, 0x75, 0x17, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0x83, 0xf8, 0x01,
+    0x74, 0xe9, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles8[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 37, AUP_HOLE_KC, NULL, 0 },
+    { 68, AUP_HOLE_IMM, NULL, 0 },
+    { 89, AUP_HOLE_TARGET, NULL, 0 },
+    { 112, AUP_HOLE_NEXT, NULL, 0 },
+    { 130, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode9[] = {
+    0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x0c, 0x17,
+    0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x89,
+    0xc6, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x5b, 0x48, 0x8b, 0x09,
+    0x48, 0x89, 0xce, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x4d, 0x66,
+    0x48, 0x0f, 0x6e, 0xc8, 0x66, 0x48, 0x0f, 0x6e, 0xc1, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x0f, 0x2f, 0xc1, 0x77,
+    0x1b, 0x48, 0x85, 0xc0, 0x75, 0x1c, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xf8, 0x01, 0x74, 0xe4, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles9[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 71, AUP_HOLE_IMM, NULL, 0 },
+    { 92, AUP_HOLE_TARGET, NULL, 0 },
+    { 120, AUP_HOLE_NEXT, NULL, 0 },
+    { 138, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode10[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x08, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48,
+    0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x5e, 0x48, 0xa1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6, 0x48,
+    0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x49, 0x66, 0x48, 0x0f, 0x6e, 0xc0,
+    0x66, 0x48, 0x0f, 0x6e, 0xc9, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x66, 0x0f, 0x2f, 0xc1, 0x77, 0x17, 0x48, 0x85, 0xc0,
+    0x75, 0x18, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0x83, 0xf8, 0x01,
+    0x74, 0xe8, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles10[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 36, AUP_HOLE_KC, NULL, 0 },
+    { 67, AUP_HOLE_IMM, NULL, 0 },
+    { 88, AUP_HOLE_TARGET, NULL, 0 },
+    { 112, AUP_HOLE_NEXT, NULL, 0 },
+    { 130, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode11[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x0c, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x8d, 0x14, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x7f, 0x48, 0x89, 0xce, 0x48, 0x21, 0xc6, 0x48, 0x39, 0xc6, 0x74,
+    0x57, 0x48, 0x8b, 0x12, 0x48, 0x89, 0xd6, 0x48, 0x21, 0xc6, 0x48, 0x39,
+    0xc6, 0x74, 0x49, 0x66, 0x48, 0x0f, 0x6e, 0xc2, 0x66, 0x48, 0x0f, 0x6e,
+    0xc9, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66,
+    0x0f, 0x2f, 0xc1, 0x73, 0x17, 0x48, 0x85, 0xc0, 0x75, 0x18, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0x83, 0xf8, 0x01, 0x74, 0xe8, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles11[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 16, AUP_HOLE_RC, NULL, 0 },
+    { 75, AUP_HOLE_IMM, NULL, 0 },
+    { 96, AUP_HOLE_TARGET, NULL, 0 },
+    { 120, AUP_HOLE_NEXT, NULL, 0 },
+    { 138, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode12[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x8b, 0x0c, 0x07,
+    0x48, 0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x5d, 0x48,
+    0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6,
+    0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x48, 0x66, 0x48, 0x0f, 0x6e,
+    0xc0, 0x66, 0x48, 0x0f, 0x6e, 0xc9, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x66, 0x0f, 0x2f, 0xc1, 0x73, 0x16, 0x48, 0x85,
+    0xc0, 0x75, 0x17, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0x83, 0xf8, 0x01,
+    0x74, 0xe9, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles12[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 37, AUP_HOLE_KC, NULL, 0 },
+    { 68, AUP_HOLE_IMM, NULL, 0 },
+    { 89, AUP_HOLE_TARGET, NULL, 0 },
+    { 112, AUP_HOLE_NEXT, NULL, 0 },
+    { 130, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode13[] = {
+    0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x0c, 0x17,
+    0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x89,
+    0xc6, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x5b, 0x48, 0x8b, 0x09,
+    0x48, 0x89, 0xce, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x4d, 0x66,
+    0x48, 0x0f, 0x6e, 0xc8, 0x66, 0x48, 0x0f, 0x6e, 0xc1, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x0f, 0x2f, 0xc1, 0x73,
+    0x1b, 0x48, 0x85, 0xc0, 0x75, 0x1c, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xf8, 0x01, 0x74, 0xe4, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x66, 0x0f,
+    0x1f, 0x44, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles13[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 71, AUP_HOLE_IMM, NULL, 0 },
+    { 92, AUP_HOLE_TARGET, NULL, 0 },
+    { 120, AUP_HOLE_NEXT, NULL, 0 },
+    { 138, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode14[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x08, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48,
+    0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x5e, 0x48, 0xa1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6, 0x48,
+    0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x49, 0x66, 0x48, 0x0f, 0x6e, 0xc0,
+    0x66, 0x48, 0x0f, 0x6e, 0xc9, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x66, 0x0f, 0x2f, 0xc1, 0x73, 0x17, 0x48, 0x85, 0xc0,
+    0x75, 0x18, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0x83, 0xf8, 0x01,
+    0x74, 0xe8, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles14[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 36, AUP_HOLE_KC, NULL, 0 },
+    { 67, AUP_HOLE_IMM, NULL, 0 },
+    { 88, AUP_HOLE_TARGET, NULL, 0 },
+    { 112, AUP_HOLE_NEXT, NULL, 0 },
+    { 130, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode15[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x48,
+    0x89, 0xfb, 0x48, 0x8b, 0x3c, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x34, 0x03, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x89, 0xfa, 0x48, 0x21, 0xc2,
+    0x48, 0x39, 0xc2, 0x74, 0x0b, 0x48, 0x89, 0xf2, 0x48, 0x21, 0xc2, 0x48,
+    0x39, 0xc2, 0x75, 0x40, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xd0, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0f, 0xb6, 0xc0, 0x48, 0x89, 0xdf, 0x48, 0x39, 0xd0, 0x74,
+    0x0f, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b,
+    0xff, 0xe0, 0x66, 0x90, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x5b, 0xff, 0xe0, 0x0f, 0x1f, 0x00, 0x66, 0x48, 0x0f, 0x6e,
+    0xc7, 0x66, 0x48, 0x0f, 0x6e, 0xce, 0xba, 0x00, 0x00, 0x00, 0x00, 0x66,
+    0x0f, 0x2e, 0xc1, 0x0f, 0x9b, 0xc0, 0x0f, 0x45, 0xc2, 0xeb, 0xb1,
+};
+static const aupHole aup_stencilHoles15[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 20, AUP_HOLE_RC, NULL, 0 },
+    { 66, AUP_HOLE_SYM, (const void *)&aup_isEqual, 0 },
+    { 78, AUP_HOLE_IMM, NULL, 0 },
+    { 99, AUP_HOLE_NEXT, NULL, 0 },
+    { 114, AUP_HOLE_TARGET, NULL, 0 },
+};
+static const uint8_t aup_stencilCode16[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x48,
+    0x89, 0xfb, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f,
+    0x48, 0x8b, 0x3c, 0x07, 0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0xf9, 0x48, 0x21, 0xd1, 0x48, 0x39, 0xd1, 0x74,
+    0x0b, 0x48, 0x89, 0xc1, 0x48, 0x21, 0xd1, 0x48, 0x39, 0xd1, 0x75, 0x44,
+    0x48, 0x89, 0xc6, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xd0, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0xb6, 0xc0, 0x48, 0x89, 0xdf, 0x48, 0x39, 0xd0, 0x74, 0x10,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff,
+    0xe0, 0x0f, 0x1f, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x5b, 0xff, 0xe0, 0x0f, 0x1f, 0x00, 0x66, 0x48, 0x0f, 0x6e,
+    0xc8, 0x66, 0x48, 0x0f, 0x6e, 0xc7, 0xba, 0x00, 0x00, 0x00, 0x00, 0x66,
+    0x0f, 0x2e, 0xc1, 0x0f, 0x9b, 0xc0, 0x0f, 0x45, 0xc2, 0xeb, 0xb0,
+};
+static const aupHole aup_stencilHoles16[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 30, AUP_HOLE_KC, NULL, 0 },
+    { 65, AUP_HOLE_SYM, (const void *)&aup_isEqual, 0 },
+    { 77, AUP_HOLE_IMM, NULL, 0 },
+    { 98, AUP_HOLE_NEXT, NULL, 0 },
+    { 114, AUP_HOLE_TARGET, NULL, 0 },
+};
+static const uint8_t aup_stencilCode17[] = {
+    0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x48,
+    0x89, 0xfb, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x8b, 0x34, 0x17, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x7f, 0x48, 0x89, 0xc1, 0x48, 0x21, 0xd1, 0x48, 0x39, 0xd1, 0x74,
+    0x0b, 0x48, 0x89, 0xf1, 0x48, 0x21, 0xd1, 0x48, 0x39, 0xd1, 0x75, 0x44,
+    0x48, 0x89, 0xc7, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xd0, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0xb6, 0xc0, 0x48, 0x89, 0xdf, 0x48, 0x39, 0xd0, 0x74, 0x10,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff,
+    0xe0, 0x0f, 0x1f, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x5b, 0xff, 0xe0, 0x0f, 0x1f, 0x00, 0x66, 0x48, 0x0f, 0x6e,
+    0xc0, 0x66, 0x48, 0x0f, 0x6e, 0xce, 0xba, 0x00, 0x00, 0x00, 0x00, 0x66,
+    0x0f, 0x2e, 0xc1, 0x0f, 0x9b, 0xc0, 0x0f, 0x45, 0xc2, 0xeb, 0xb0,
+};
+static const aupHole aup_stencilHoles17[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 16, AUP_HOLE_RC, NULL, 0 },
+    { 65, AUP_HOLE_SYM, (const void *)&aup_isEqual, 0 },
+    { 77, AUP_HOLE_IMM, NULL, 0 },
+    { 98, AUP_HOLE_NEXT, NULL, 0 },
+    { 114, AUP_HOLE_TARGET, NULL, 0 },
+};
+static const uint8_t aup_stencilCode18[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x48,
+    0x89, 0xfb, 0x48, 0x8b, 0x38, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xfc, 0x7f, 0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x89, 0xf9, 0x48, 0x21, 0xd1, 0x48, 0x39, 0xd1, 0x74, 0x0b,
+    0x48, 0x89, 0xc1, 0x48, 0x21, 0xd1, 0x48, 0x39, 0xd1, 0x75, 0x45, 0x48,
+    0x89, 0xc6, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xd0, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0f, 0xb6, 0xc0, 0x48, 0x89, 0xdf, 0x48, 0x39, 0xd0, 0x74, 0x11, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0xe0,
+    0x0f, 0x1f, 0x40, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x5b, 0xff, 0xe0, 0x0f, 0x1f, 0x00, 0x66, 0x48, 0x0f, 0x6e,
+    0xc8, 0x66, 0x48, 0x0f, 0x6e, 0xc7, 0xba, 0x00, 0x00, 0x00, 0x00, 0x66,
+    0x0f, 0x2e, 0xc1, 0x0f, 0x9b, 0xc0, 0x0f, 0x45, 0xc2, 0xeb, 0xaf,
+};
+static const aupHole aup_stencilHoles18[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 29, AUP_HOLE_KC, NULL, 0 },
+    { 64, AUP_HOLE_SYM, (const void *)&aup_isEqual, 0 },
+    { 76, AUP_HOLE_IMM, NULL, 0 },
+    { 97, AUP_HOLE_NEXT, NULL, 0 },
+    { 114, AUP_HOLE_TARGET, NULL, 0 },
+};
+static const uint8_t aup_stencilCode19[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0xba, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x04, 0x07, 0x48, 0x01,
+    0xfa, 0x48, 0x89, 0xc6, 0x48, 0x21, 0xce, 0x48, 0x39, 0xce, 0x74, 0x40,
+    0x66, 0x48, 0x0f, 0x6e, 0xc8, 0x66, 0x0f, 0xef, 0xc0, 0xb9, 0x00, 0x00,
+    0x00, 0x00, 0x66, 0x0f, 0x2e, 0xc8, 0x0f, 0x9b, 0xc0, 0x0f, 0x45, 0xc1,
+    0x48, 0xb9, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x0f, 0xb6,
+    0xc0, 0x48, 0x01, 0xc8, 0x48, 0x89, 0x02, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x84, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0xb9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x03, 0x80, 0x48, 0x01, 0xc8, 0x48, 0x83, 0xf8, 0x01, 0x0f, 0x96, 0xc0,
+    0xeb, 0xc2,
+};
+static const aupHole aup_stencilHoles19[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 22, AUP_HOLE_RA, NULL, 0 },
+    { 93, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode20[] = {
+    0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0xba, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xfa, 0x48, 0x89, 0xc6,
+    0x48, 0x21, 0xce, 0x48, 0x39, 0xce, 0x74, 0x3c, 0x66, 0x48, 0x0f, 0x6e,
+    0xc8, 0x66, 0x0f, 0xef, 0xc0, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x66, 0x0f,
+    0x2e, 0xc8, 0x0f, 0x9b, 0xc0, 0x0f, 0x45, 0xc1, 0x48, 0xb9, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x0f, 0xb6, 0xc0, 0x48, 0x01, 0xc8,
+    0x48, 0x89, 0x02, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0xb9, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x03, 0x80, 0x48, 0x01, 0xc8, 0x48, 0x83, 0xf8,
+    0x01, 0x0f, 0x96, 0xc0, 0xeb, 0xc6,
+};
+static const aupHole aup_stencilHoles20[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 22, AUP_HOLE_RA, NULL, 0 },
+    { 89, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode21[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x0c, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x8d, 0x14, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x7f, 0x48, 0x89, 0xce, 0x48, 0x21, 0xc6, 0x48, 0x39, 0xc6, 0x74,
+    0x4f, 0x48, 0x8b, 0x12, 0x48, 0x89, 0xd6, 0x48, 0x21, 0xc6, 0x48, 0x39,
+    0xc6, 0x74, 0x41, 0x66, 0x48, 0x0f, 0x6e, 0xc2, 0x66, 0x48, 0x0f, 0x6e,
+    0xc9, 0x48, 0x8d, 0x40, 0x03, 0x48, 0xba, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xfc, 0x7f, 0x66, 0x0f, 0x2f, 0xc1, 0x48, 0x0f, 0x46, 0xc2, 0x48,
+    0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04,
+    0x17, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xe0, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles21[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 16, AUP_HOLE_RC, NULL, 0 },
+    { 97, AUP_HOLE_RA, NULL, 0 },
+    { 111, AUP_HOLE_NEXT, NULL, 0 },
+    { 130, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode22[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x8b, 0x0c, 0x07,
+    0x48, 0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x55, 0x48,
+    0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6,
+    0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x40, 0x66, 0x48, 0x0f, 0x6e,
+    0xc0, 0x66, 0x48, 0x0f, 0x6e, 0xc9, 0x48, 0x8d, 0x52, 0x02, 0x48, 0xb8,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x66, 0x0f, 0x2f, 0xc1,
+    0x48, 0x0f, 0x46, 0xc2, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x04, 0x17, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles22[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 37, AUP_HOLE_KC, NULL, 0 },
+    { 90, AUP_HOLE_RA, NULL, 0 },
+    { 104, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode23[] = {
+    0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x0c, 0x17,
+    0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x89,
+    0xc6, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x4b, 0x48, 0x8b, 0x09,
+    0x48, 0x89, 0xce, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x3d, 0x66,
+    0x48, 0x0f, 0x6e, 0xc8, 0x66, 0x48, 0x0f, 0x6e, 0xc1, 0x48, 0x8d, 0x52,
+    0x02, 0x48, 0xb8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x66,
+    0x0f, 0x2f, 0xc1, 0x48, 0x0f, 0x46, 0xc2, 0x48, 0xba, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x17, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x0f, 0x1f, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles23[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 93, AUP_HOLE_RA, NULL, 0 },
+    { 107, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode24[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x08, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48,
+    0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x56, 0x48, 0xa1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6, 0x48,
+    0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x41, 0x66, 0x48, 0x0f, 0x6e, 0xc0,
+    0x66, 0x48, 0x0f, 0x6e, 0xc9, 0x48, 0x8d, 0x52, 0x02, 0x48, 0xb8, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x66, 0x0f, 0x2f, 0xc1, 0x48,
+    0x0f, 0x46, 0xc2, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x89, 0x04, 0x17, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xe0, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles24[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 36, AUP_HOLE_KC, NULL, 0 },
+    { 89, AUP_HOLE_RA, NULL, 0 },
+    { 103, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode25[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x0c, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x8d, 0x14, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x7f, 0x48, 0x89, 0xce, 0x48, 0x21, 0xc6, 0x48, 0x39, 0xc6, 0x74,
+    0x4f, 0x48, 0x8b, 0x12, 0x48, 0x89, 0xd6, 0x48, 0x21, 0xc6, 0x48, 0x39,
+    0xc6, 0x74, 0x41, 0x66, 0x48, 0x0f, 0x6e, 0xc2, 0x66, 0x48, 0x0f, 0x6e,
+    0xc9, 0x48, 0x8d, 0x40, 0x03, 0x48, 0xba, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xfc, 0x7f, 0x66, 0x0f, 0x2f, 0xc1, 0x48, 0x0f, 0x42, 0xc2, 0x48,
+    0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04,
+    0x17, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xe0, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles25[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 16, AUP_HOLE_RC, NULL, 0 },
+    { 97, AUP_HOLE_RA, NULL, 0 },
+    { 111, AUP_HOLE_NEXT, NULL, 0 },
+    { 130, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode26[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x8b, 0x0c, 0x07,
+    0x48, 0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x55, 0x48,
+    0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6,
+    0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x40, 0x66, 0x48, 0x0f, 0x6e,
+    0xc0, 0x66, 0x48, 0x0f, 0x6e, 0xc9, 0x48, 0x8d, 0x52, 0x02, 0x48, 0xb8,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x66, 0x0f, 0x2f, 0xc1,
+    0x48, 0x0f, 0x42, 0xc2, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x04, 0x17, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles26[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 37, AUP_HOLE_KC, NULL, 0 },
+    { 90, AUP_HOLE_RA, NULL, 0 },
+    { 104, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode27[] = {
+    0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x0c, 0x17,
+    0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x89,
+    0xc6, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x4b, 0x48, 0x8b, 0x09,
+    0x48, 0x89, 0xce, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x3d, 0x66,
+    0x48, 0x0f, 0x6e, 0xc8, 0x66, 0x48, 0x0f, 0x6e, 0xc1, 0x48, 0x8d, 0x52,
+    0x02, 0x48, 0xb8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x66,
+    0x0f, 0x2f, 0xc1, 0x48, 0x0f, 0x42, 0xc2, 0x48, 0xba, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x17, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x0f, 0x1f, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles27[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 93, AUP_HOLE_RA, NULL, 0 },
+    { 107, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode28[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x08, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48,
+    0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x56, 0x48, 0xa1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6, 0x48,
+    0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x41, 0x66, 0x48, 0x0f, 0x6e, 0xc0,
+    0x66, 0x48, 0x0f, 0x6e, 0xc9, 0x48, 0x8d, 0x52, 0x02, 0x48, 0xb8, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x66, 0x0f, 0x2f, 0xc1, 0x48,
+    0x0f, 0x42, 0xc2, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x89, 0x04, 0x17, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xe0, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles28[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 36, AUP_HOLE_KC, NULL, 0 },
+    { 89, AUP_HOLE_RA, NULL, 0 },
+    { 103, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode29[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x14, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x8d, 0x0c, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x7f, 0x48, 0x89, 0xd6, 0x48, 0x21, 0xc6, 0x48, 0x39, 0xc6, 0x74,
+    0x4f, 0x48, 0x8b, 0x09, 0x48, 0x89, 0xce, 0x48, 0x21, 0xc6, 0x48, 0x39,
+    0xc6, 0x74, 0x41, 0x66, 0x48, 0x0f, 0x6e, 0xc2, 0x66, 0x48, 0x0f, 0x6e,
+    0xc9, 0x48, 0x8d, 0x40, 0x03, 0x48, 0xba, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xfc, 0x7f, 0x66, 0x0f, 0x2f, 0xc1, 0x48, 0x0f, 0x46, 0xc2, 0x48,
+    0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04,
+    0x17, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xe0, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles29[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 16, AUP_HOLE_RC, NULL, 0 },
+    { 97, AUP_HOLE_RA, NULL, 0 },
+    { 111, AUP_HOLE_NEXT, NULL, 0 },
+    { 130, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode30[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x8b, 0x0c, 0x07,
+    0x48, 0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x55, 0x48,
+    0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6,
+    0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x40, 0x66, 0x48, 0x0f, 0x6e,
+    0xc8, 0x66, 0x48, 0x0f, 0x6e, 0xc1, 0x48, 0x8d, 0x52, 0x02, 0x48, 0xb8,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x66, 0x0f, 0x2f, 0xc1,
+    0x48, 0x0f, 0x46, 0xc2, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x04, 0x17, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles30[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 37, AUP_HOLE_KC, NULL, 0 },
+    { 90, AUP_HOLE_RA, NULL, 0 },
+    { 104, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode31[] = {
+    0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x0c, 0x17,
+    0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x89,
+    0xc6, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x4b, 0x48, 0x8b, 0x09,
+    0x48, 0x89, 0xce, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x3d, 0x66,
+    0x48, 0x0f, 0x6e, 0xc0, 0x66, 0x48, 0x0f, 0x6e, 0xc9, 0x48, 0x8d, 0x52,
+    0x02, 0x48, 0xb8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x66,
+    0x0f, 0x2f, 0xc1, 0x48, 0x0f, 0x46, 0xc2, 0x48, 0xba, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x17, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x0f, 0x1f, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles31[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 93, AUP_HOLE_RA, NULL, 0 },
+    { 107, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode32[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x08, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48,
+    0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x56, 0x48, 0xa1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6, 0x48,
+    0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x41, 0x66, 0x48, 0x0f, 0x6e, 0xc8,
+    0x66, 0x48, 0x0f, 0x6e, 0xc1, 0x48, 0x8d, 0x52, 0x02, 0x48, 0xb8, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x66, 0x0f, 0x2f, 0xc1, 0x48,
+    0x0f, 0x46, 0xc2, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x89, 0x04, 0x17, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xe0, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles32[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 36, AUP_HOLE_KC, NULL, 0 },
+    { 89, AUP_HOLE_RA, NULL, 0 },
+    { 103, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode33[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x14, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x8d, 0x0c, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x7f, 0x48, 0x89, 0xd6, 0x48, 0x21, 0xc6, 0x48, 0x39, 0xc6, 0x74,
+    0x4f, 0x48, 0x8b, 0x09, 0x48, 0x89, 0xce, 0x48, 0x21, 0xc6, 0x48, 0x39,
+    0xc6, 0x74, 0x41, 0x66, 0x48, 0x0f, 0x6e, 0xc2, 0x66, 0x48, 0x0f, 0x6e,
+    0xc9, 0x48, 0x8d, 0x40, 0x03, 0x48, 0xba, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xfc, 0x7f, 0x66, 0x0f, 0x2f, 0xc1, 0x48, 0x0f, 0x42, 0xc2, 0x48,
+    0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04,
+    0x17, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xe0, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles33[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 16, AUP_HOLE_RC, NULL, 0 },
+    { 97, AUP_HOLE_RA, NULL, 0 },
+    { 111, AUP_HOLE_NEXT, NULL, 0 },
+    { 130, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode34[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x8b, 0x0c, 0x07,
+    0x48, 0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x55, 0x48,
+    0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6,
+    0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x40, 0x66, 0x48, 0x0f, 0x6e,
+    0xc8, 0x66, 0x48, 0x0f, 0x6e, 0xc1, 0x48, 0x8d, 0x52, 0x02, 0x48, 0xb8,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x66, 0x0f, 0x2f, 0xc1,
+    0x48, 0x0f, 0x42, 0xc2, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x04, 0x17, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles34[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 37, AUP_HOLE_KC, NULL, 0 },
+    { 90, AUP_HOLE_RA, NULL, 0 },
+    { 104, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode35[] = {
+    0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x0c, 0x17,
+    0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x89,
+    0xc6, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x4b, 0x48, 0x8b, 0x09,
+    0x48, 0x89, 0xce, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x3d, 0x66,
+    0x48, 0x0f, 0x6e, 0xc0, 0x66, 0x48, 0x0f, 0x6e, 0xc9, 0x48, 0x8d, 0x52,
+    0x02, 0x48, 0xb8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x66,
+    0x0f, 0x2f, 0xc1, 0x48, 0x0f, 0x42, 0xc2, 0x48, 0xba, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x17, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x0f, 0x1f, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles35[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 93, AUP_HOLE_RA, NULL, 0 },
+    { 107, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode36[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x08, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48,
+    0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x56, 0x48, 0xa1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6, 0x48,
+    0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x41, 0x66, 0x48, 0x0f, 0x6e, 0xc8,
+    0x66, 0x48, 0x0f, 0x6e, 0xc1, 0x48, 0x8d, 0x52, 0x02, 0x48, 0xb8, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x66, 0x0f, 0x2f, 0xc1, 0x48,
+    0x0f, 0x42, 0xc2, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x48, 0x89, 0x04, 0x17, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xe0, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles36[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 36, AUP_HOLE_KC, NULL, 0 },
+    { 89, AUP_HOLE_RA, NULL, 0 },
+    { 103, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode37[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x48, 0x01,
+    0xfd, 0x48, 0x89, 0xfb, 0x48, 0x83, 0xec, 0x08, 0x48, 0x8b, 0x3c, 0x07,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x34, 0x03, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f,
+    0x48, 0x89, 0xfa, 0x48, 0x21, 0xc2, 0x48, 0x39, 0xc2, 0x74, 0x0b, 0x48,
+    0x89, 0xf2, 0x48, 0x21, 0xc2, 0x48, 0x39, 0xc2, 0x75, 0x3e, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd0, 0x48, 0xba,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x0f, 0xb6, 0xc0, 0x48,
+    0x89, 0xdf, 0x48, 0x01, 0xd0, 0x48, 0x89, 0x45, 0x00, 0x48, 0x83, 0xc4,
+    0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b,
+    0x5d, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x66, 0x48, 0x0f, 0x6e, 0xc7, 0x66, 0x48, 0x0f, 0x6e, 0xce, 0xba, 0x00,
+    0x00, 0x00, 0x00, 0x66, 0x0f, 0x2e, 0xc1, 0x0f, 0x9b, 0xc0, 0x0f, 0x45,
+    0xc2, 0xeb, 0xb3,
+};
+static const aupHole aup_stencilHoles37[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 13, AUP_HOLE_RA, NULL, 0 },
+    { 38, AUP_HOLE_RC, NULL, 0 },
+    { 84, AUP_HOLE_SYM, (const void *)&aup_isEqual, 0 },
+    { 123, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode38[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x53, 0x48, 0x01, 0xfd, 0x48,
+    0x89, 0xfb, 0x48, 0x83, 0xec, 0x08, 0x48, 0x8b, 0x3c, 0x07, 0x48, 0xa1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xf9, 0x48,
+    0x21, 0xd1, 0x48, 0x39, 0xd1, 0x74, 0x0b, 0x48, 0x89, 0xc1, 0x48, 0x21,
+    0xd1, 0x48, 0x39, 0xd1, 0x75, 0x42, 0x48, 0x89, 0xc6, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd0, 0x48, 0xba, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x0f, 0xb6, 0xc0, 0x48, 0x89,
+    0xdf, 0x48, 0x01, 0xd0, 0x48, 0x89, 0x45, 0x00, 0x48, 0x83, 0xc4, 0x08,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x5d,
+    0xff, 0xe0, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x66, 0x48, 0x0f, 0x6e, 0xc8, 0x66, 0x48, 0x0f, 0x6e, 0xc7, 0xba, 0x00,
+    0x00, 0x00, 0x00, 0x66, 0x0f, 0x2e, 0xc1, 0x0f, 0x9b, 0xc0, 0x0f, 0x45,
+    0xc2, 0xeb, 0xb2,
+};
+static const aupHole aup_stencilHoles38[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 13, AUP_HOLE_RA, NULL, 0 },
+    { 48, AUP_HOLE_KC, NULL, 0 },
+    { 83, AUP_HOLE_SYM, (const void *)&aup_isEqual, 0 },
+    { 122, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode39[] = {
+    0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x48, 0x01,
+    0xfd, 0x48, 0x89, 0xfb, 0x48, 0x83, 0xec, 0x08, 0x48, 0x8b, 0x34, 0x17,
+    0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x89, 0xc1, 0x48,
+    0x21, 0xd1, 0x48, 0x39, 0xd1, 0x74, 0x0b, 0x48, 0x89, 0xf1, 0x48, 0x21,
+    0xd1, 0x48, 0x39, 0xd1, 0x75, 0x42, 0x48, 0x89, 0xc7, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd0, 0x48, 0xba, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x0f, 0xb6, 0xc0, 0x48, 0x89,
+    0xdf, 0x48, 0x01, 0xd0, 0x48, 0x89, 0x45, 0x00, 0x48, 0x83, 0xc4, 0x08,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x5d,
+    0xff, 0xe0, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x66, 0x48, 0x0f, 0x6e, 0xc0, 0x66, 0x48, 0x0f, 0x6e, 0xce, 0xba, 0x00,
+    0x00, 0x00, 0x00, 0x66, 0x0f, 0x2e, 0xc1, 0x0f, 0x9b, 0xc0, 0x0f, 0x45,
+    0xc2, 0xeb, 0xb2,
+};
+static const aupHole aup_stencilHoles39[] = {
+    { 2, AUP_HOLE_RC, NULL, 0 },
+    { 13, AUP_HOLE_RA, NULL, 0 },
+    { 38, AUP_HOLE_KB, NULL, 0 },
+    { 83, AUP_HOLE_SYM, (const void *)&aup_isEqual, 0 },
+    { 122, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode40[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x53, 0x48, 0x01, 0xfd, 0x48,
+    0x89, 0xfb, 0x48, 0x83, 0xec, 0x08, 0x48, 0x8b, 0x38, 0x48, 0xa1, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xf9, 0x48, 0x21,
+    0xd1, 0x48, 0x39, 0xd1, 0x74, 0x0b, 0x48, 0x89, 0xc1, 0x48, 0x21, 0xd1,
+    0x48, 0x39, 0xd1, 0x75, 0x3b, 0x48, 0x89, 0xc6, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd0, 0x48, 0xba, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x0f, 0xb6, 0xc0, 0x48, 0x89, 0xdf,
+    0x48, 0x01, 0xd0, 0x48, 0x89, 0x45, 0x00, 0x48, 0x83, 0xc4, 0x08, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x5d, 0xff,
+    0xe0, 0x0f, 0x1f, 0x00, 0x66, 0x48, 0x0f, 0x6e, 0xc8, 0x66, 0x48, 0x0f,
+    0x6e, 0xc7, 0xba, 0x00, 0x00, 0x00, 0x00, 0x66, 0x0f, 0x2e, 0xc1, 0x0f,
+    0x9b, 0xc0, 0x0f, 0x45, 0xc2, 0xeb, 0xb9,
+};
+static const aupHole aup_stencilHoles40[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 13, AUP_HOLE_RA, NULL, 0 },
+    { 47, AUP_HOLE_KC, NULL, 0 },
+    { 82, AUP_HOLE_SYM, (const void *)&aup_isEqual, 0 },
+    { 121, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode41[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x8b, 0x04, 0x07,
+    0x48, 0x89, 0xc1, 0x48, 0x21, 0xd1, 0x48, 0x39, 0xd1, 0x74, 0x35, 0x48,
+    0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x48, 0x0f,
+    0x6e, 0xc0, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x66, 0x0f, 0x57, 0x02, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf2, 0x0f, 0x11, 0x04, 0x17, 0xff, 0xe0, 0x0f, 0x1f, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xc3,
+};
+static const uint8_t aup_stencilData41[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+};
+static const aupHole aup_stencilHoles41[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 37, AUP_HOLE_DATA, NULL, 0 },
+    { 52, AUP_HOLE_NEXT, NULL, 0 },
+    { 66, AUP_HOLE_RA, NULL, 0 },
+    { 90, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode42[] = {
+    0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x89, 0xc1, 0x48,
+    0x21, 0xd1, 0x48, 0x39, 0xd1, 0x74, 0x31, 0x48, 0xba, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x48, 0x0f, 0x6e, 0xc0, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x0f, 0x57, 0x02,
+    0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x11, 0x04, 0x17, 0xff, 0xe0, 0x0f, 0x1f, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const uint8_t aup_stencilData42[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+};
+static const aupHole aup_stencilHoles42[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 33, AUP_HOLE_DATA, NULL, 0 },
+    { 48, AUP_HOLE_NEXT, NULL, 0 },
+    { 62, AUP_HOLE_RA, NULL, 0 },
+    { 82, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode43[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x0c, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x8d, 0x14, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x7f, 0x48, 0x89, 0xce, 0x48, 0x21, 0xc6, 0x48, 0x39, 0xc6, 0x74,
+    0x3f, 0x48, 0x8b, 0x12, 0x48, 0x89, 0xd6, 0x48, 0x21, 0xc6, 0x48, 0x39,
+    0xc6, 0x74, 0x31, 0x66, 0x48, 0x0f, 0x6e, 0xc1, 0x66, 0x48, 0x0f, 0x6e,
+    0xca, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2,
+    0x0f, 0x58, 0xc1, 0xf2, 0x0f, 0x11, 0x04, 0x07, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x0f, 0x1f, 0x84, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles43[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 16, AUP_HOLE_RC, NULL, 0 },
+    { 75, AUP_HOLE_RA, NULL, 0 },
+    { 94, AUP_HOLE_NEXT, NULL, 0 },
+    { 114, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode44[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x8b, 0x0c, 0x07,
+    0x48, 0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x45, 0x48,
+    0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6,
+    0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x30, 0x66, 0x48, 0x0f, 0x6e,
+    0xc8, 0x66, 0x48, 0x0f, 0x6e, 0xc1, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x58, 0xc1, 0xf2, 0x0f, 0x11, 0x04,
+    0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xe0, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles44[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 37, AUP_HOLE_KC, NULL, 0 },
+    { 68, AUP_HOLE_RA, NULL, 0 },
+    { 87, AUP_HOLE_NEXT, NULL, 0 },
+    { 106, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode45[] = {
+    0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x0c, 0x17,
+    0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x89,
+    0xc6, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x3b, 0x48, 0x8b, 0x09,
+    0x48, 0x89, 0xce, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x2d, 0x66,
+    0x48, 0x0f, 0x6e, 0xc0, 0x66, 0x48, 0x0f, 0x6e, 0xc9, 0x48, 0xba, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x58, 0xc1, 0xf2, 0x0f, 0x11,
+    0x04, 0x17, 0xff, 0xe0, 0x0f, 0x1f, 0x40, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles45[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 71, AUP_HOLE_RA, NULL, 0 },
+    { 81, AUP_HOLE_NEXT, NULL, 0 },
+    { 106, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode46[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x08, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48,
+    0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x3e, 0x48, 0xa1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6, 0x48,
+    0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x29, 0x66, 0x48, 0x0f, 0x6e, 0xc8,
+    0x66, 0x48, 0x0f, 0x6e, 0xc1, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf2, 0x0f, 0x58, 0xc1, 0xf2, 0x0f, 0x11, 0x04, 0x07,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles46[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 36, AUP_HOLE_KC, NULL, 0 },
+    { 67, AUP_HOLE_RA, NULL, 0 },
+    { 86, AUP_HOLE_NEXT, NULL, 0 },
+    { 98, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode47[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x0c, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x8d, 0x14, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x7f, 0x48, 0x89, 0xce, 0x48, 0x21, 0xc6, 0x48, 0x39, 0xc6, 0x74,
+    0x3f, 0x48, 0x8b, 0x12, 0x48, 0x89, 0xd6, 0x48, 0x21, 0xc6, 0x48, 0x39,
+    0xc6, 0x74, 0x31, 0x66, 0x48, 0x0f, 0x6e, 0xc1, 0x66, 0x48, 0x0f, 0x6e,
+    0xca, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2,
+    0x0f, 0x5c, 0xc1, 0xf2, 0x0f, 0x11, 0x04, 0x07, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x0f, 0x1f, 0x84, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles47[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 16, AUP_HOLE_RC, NULL, 0 },
+    { 75, AUP_HOLE_RA, NULL, 0 },
+    { 94, AUP_HOLE_NEXT, NULL, 0 },
+    { 114, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode48[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x8b, 0x0c, 0x07,
+    0x48, 0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x45, 0x48,
+    0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6,
+    0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x30, 0x66, 0x48, 0x0f, 0x6e,
+    0xc8, 0x66, 0x48, 0x0f, 0x6e, 0xc1, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x5c, 0xc1, 0xf2, 0x0f, 0x11, 0x04,
+    0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xe0, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles48[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 37, AUP_HOLE_KC, NULL, 0 },
+    { 68, AUP_HOLE_RA, NULL, 0 },
+    { 87, AUP_HOLE_NEXT, NULL, 0 },
+    { 106, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode49[] = {
+    0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x0c, 0x17,
+    0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x89,
+    0xc6, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x3b, 0x48, 0x8b, 0x09,
+    0x48, 0x89, 0xce, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x2d, 0x66,
+    0x48, 0x0f, 0x6e, 0xc0, 0x66, 0x48, 0x0f, 0x6e, 0xc9, 0x48, 0xba, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x5c, 0xc1, 0xf2, 0x0f, 0x11,
+    0x04, 0x17, 0xff, 0xe0, 0x0f, 0x1f, 0x40, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles49[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 71, AUP_HOLE_RA, NULL, 0 },
+    { 81, AUP_HOLE_NEXT, NULL, 0 },
+    { 106, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode50[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x08, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48,
+    0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x3e, 0x48, 0xa1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6, 0x48,
+    0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x29, 0x66, 0x48, 0x0f, 0x6e, 0xc8,
+    0x66, 0x48, 0x0f, 0x6e, 0xc1, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf2, 0x0f, 0x5c, 0xc1, 0xf2, 0x0f, 0x11, 0x04, 0x07,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles50[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 36, AUP_HOLE_KC, NULL, 0 },
+    { 67, AUP_HOLE_RA, NULL, 0 },
+    { 86, AUP_HOLE_NEXT, NULL, 0 },
+    { 98, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode51[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x0c, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x8d, 0x14, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x7f, 0x48, 0x89, 0xce, 0x48, 0x21, 0xc6, 0x48, 0x39, 0xc6, 0x74,
+    0x3f, 0x48, 0x8b, 0x12, 0x48, 0x89, 0xd6, 0x48, 0x21, 0xc6, 0x48, 0x39,
+    0xc6, 0x74, 0x31, 0x66, 0x48, 0x0f, 0x6e, 0xc1, 0x66, 0x48, 0x0f, 0x6e,
+    0xca, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2,
+    0x0f, 0x59, 0xc1, 0xf2, 0x0f, 0x11, 0x04, 0x07, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x0f, 0x1f, 0x84, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles51[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 16, AUP_HOLE_RC, NULL, 0 },
+    { 75, AUP_HOLE_RA, NULL, 0 },
+    { 94, AUP_HOLE_NEXT, NULL, 0 },
+    { 114, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode52[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x8b, 0x0c, 0x07,
+    0x48, 0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x45, 0x48,
+    0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6,
+    0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x30, 0x66, 0x48, 0x0f, 0x6e,
+    0xc8, 0x66, 0x48, 0x0f, 0x6e, 0xc1, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x59, 0xc1, 0xf2, 0x0f, 0x11, 0x04,
+    0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xe0, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles52[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 37, AUP_HOLE_KC, NULL, 0 },
+    { 68, AUP_HOLE_RA, NULL, 0 },
+    { 87, AUP_HOLE_NEXT, NULL, 0 },
+    { 106, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode53[] = {
+    0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x0c, 0x17,
+    0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x89,
+    0xc6, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x3b, 0x48, 0x8b, 0x09,
+    0x48, 0x89, 0xce, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x2d, 0x66,
+    0x48, 0x0f, 0x6e, 0xc0, 0x66, 0x48, 0x0f, 0x6e, 0xc9, 0x48, 0xba, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x59, 0xc1, 0xf2, 0x0f, 0x11,
+    0x04, 0x17, 0xff, 0xe0, 0x0f, 0x1f, 0x40, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles53[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 71, AUP_HOLE_RA, NULL, 0 },
+    { 81, AUP_HOLE_NEXT, NULL, 0 },
+    { 106, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode54[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x08, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48,
+    0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x3e, 0x48, 0xa1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6, 0x48,
+    0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x29, 0x66, 0x48, 0x0f, 0x6e, 0xc8,
+    0x66, 0x48, 0x0f, 0x6e, 0xc1, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf2, 0x0f, 0x59, 0xc1, 0xf2, 0x0f, 0x11, 0x04, 0x07,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles54[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 36, AUP_HOLE_KC, NULL, 0 },
+    { 67, AUP_HOLE_RA, NULL, 0 },
+    { 86, AUP_HOLE_NEXT, NULL, 0 },
+    { 98, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode55[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x0c, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x8d, 0x14, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x7f, 0x48, 0x89, 0xce, 0x48, 0x21, 0xc6, 0x48, 0x39, 0xc6, 0x74,
+    0x3f, 0x48, 0x8b, 0x12, 0x48, 0x89, 0xd6, 0x48, 0x21, 0xc6, 0x48, 0x39,
+    0xc6, 0x74, 0x31, 0x66, 0x48, 0x0f, 0x6e, 0xc1, 0x66, 0x48, 0x0f, 0x6e,
+    0xca, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2,
+    0x0f, 0x5e, 0xc1, 0xf2, 0x0f, 0x11, 0x04, 0x07, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x0f, 0x1f, 0x84, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles55[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 16, AUP_HOLE_RC, NULL, 0 },
+    { 75, AUP_HOLE_RA, NULL, 0 },
+    { 94, AUP_HOLE_NEXT, NULL, 0 },
+    { 114, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode56[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x8b, 0x0c, 0x07,
+    0x48, 0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x45, 0x48,
+    0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6,
+    0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x30, 0x66, 0x48, 0x0f, 0x6e,
+    0xc8, 0x66, 0x48, 0x0f, 0x6e, 0xc1, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x5e, 0xc1, 0xf2, 0x0f, 0x11, 0x04,
+    0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xe0, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles56[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 37, AUP_HOLE_KC, NULL, 0 },
+    { 68, AUP_HOLE_RA, NULL, 0 },
+    { 87, AUP_HOLE_NEXT, NULL, 0 },
+    { 106, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode57[] = {
+    0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x0c, 0x17,
+    0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x89,
+    0xc6, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x3b, 0x48, 0x8b, 0x09,
+    0x48, 0x89, 0xce, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x2d, 0x66,
+    0x48, 0x0f, 0x6e, 0xc0, 0x66, 0x48, 0x0f, 0x6e, 0xc9, 0x48, 0xba, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x5e, 0xc1, 0xf2, 0x0f, 0x11,
+    0x04, 0x17, 0xff, 0xe0, 0x0f, 0x1f, 0x40, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles57[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 71, AUP_HOLE_RA, NULL, 0 },
+    { 81, AUP_HOLE_NEXT, NULL, 0 },
+    { 106, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode58[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x08, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48,
+    0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x3e, 0x48, 0xa1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6, 0x48,
+    0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x29, 0x66, 0x48, 0x0f, 0x6e, 0xc8,
+    0x66, 0x48, 0x0f, 0x6e, 0xc1, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf2, 0x0f, 0x5e, 0xc1, 0xf2, 0x0f, 0x11, 0x04, 0x07,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles58[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 36, AUP_HOLE_KC, NULL, 0 },
+    { 67, AUP_HOLE_RA, NULL, 0 },
+    { 86, AUP_HOLE_NEXT, NULL, 0 },
+    { 98, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode59[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x0c, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x8d, 0x14, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x7f, 0x48, 0x89, 0xce, 0x48, 0x21, 0xc6, 0x48, 0x39, 0xc6, 0x74,
+    0x4f, 0x48, 0x8b, 0x12, 0x48, 0x89, 0xd6, 0x48, 0x21, 0xc6, 0x48, 0x39,
+    0xc6, 0x74, 0x41, 0x53, 0x66, 0x48, 0x0f, 0x6e, 0xca, 0x48, 0x89, 0xfb,
+    0x66, 0x48, 0x0f, 0x6e, 0xc1, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xd0, 0x48, 0x89, 0xdf, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x04, 0x03, 0x5b,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles59[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 16, AUP_HOLE_RC, NULL, 0 },
+    { 79, AUP_HOLE_SYM, (const void *)&fmod, 0 },
+    { 94, AUP_HOLE_RA, NULL, 0 },
+    { 110, AUP_HOLE_NEXT, NULL, 0 },
+    { 130, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode60[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x8b, 0x0c, 0x07,
+    0x48, 0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x55, 0x48,
+    0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6,
+    0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x40, 0x53, 0x66, 0x48, 0x0f,
+    0x6e, 0xc8, 0x48, 0x89, 0xfb, 0x66, 0x48, 0x0f, 0x6e, 0xc1, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd0, 0x48, 0x89,
+    0xdf, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2,
+    0x0f, 0x11, 0x04, 0x03, 0x5b, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xe0, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles60[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 37, AUP_HOLE_KC, NULL, 0 },
+    { 72, AUP_HOLE_SYM, (const void *)&fmod, 0 },
+    { 87, AUP_HOLE_RA, NULL, 0 },
+    { 103, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode61[] = {
+    0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x0c, 0x17,
+    0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x89,
+    0xc6, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x4b, 0x48, 0x8b, 0x09,
+    0x48, 0x89, 0xce, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x3d, 0x53,
+    0x66, 0x48, 0x0f, 0x6e, 0xc0, 0x48, 0x89, 0xfb, 0x66, 0x48, 0x0f, 0x6e,
+    0xc9, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xd0, 0x48, 0x89, 0xdf, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf2, 0x0f, 0x11, 0x04, 0x03, 0x5b, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x0f, 0x1f, 0x40, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles61[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 75, AUP_HOLE_SYM, (const void *)&fmod, 0 },
+    { 90, AUP_HOLE_RA, NULL, 0 },
+    { 106, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode62[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x08, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48,
+    0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x4e, 0x48, 0xa1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6, 0x48,
+    0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x39, 0x53, 0x66, 0x48, 0x0f, 0x6e,
+    0xc8, 0x48, 0x89, 0xfb, 0x66, 0x48, 0x0f, 0x6e, 0xc1, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd0, 0x48, 0x89, 0xdf,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x11, 0x04, 0x03, 0x5b, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xe0, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles62[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 36, AUP_HOLE_KC, NULL, 0 },
+    { 71, AUP_HOLE_SYM, (const void *)&fmod, 0 },
+    { 86, AUP_HOLE_RA, NULL, 0 },
+    { 102, AUP_HOLE_NEXT, NULL, 0 },
+    { 114, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode63[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x0c, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x8d, 0x14, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x7f, 0x48, 0x89, 0xce, 0x48, 0x21, 0xc6, 0x48, 0x39, 0xc6, 0x74,
+    0x4f, 0x48, 0x8b, 0x12, 0x48, 0x89, 0xd6, 0x48, 0x21, 0xc6, 0x48, 0x39,
+    0xc6, 0x74, 0x41, 0x53, 0x66, 0x48, 0x0f, 0x6e, 0xca, 0x48, 0x89, 0xfb,
+    0x66, 0x48, 0x0f, 0x6e, 0xc1, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xd0, 0x48, 0x89, 0xdf, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x04, 0x03, 0x5b,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles63[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 16, AUP_HOLE_RC, NULL, 0 },
+    { 79, AUP_HOLE_SYM, (const void *)&pow, 0 },
+    { 94, AUP_HOLE_RA, NULL, 0 },
+    { 110, AUP_HOLE_NEXT, NULL, 0 },
+    { 130, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode64[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x8b, 0x0c, 0x07,
+    0x48, 0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x55, 0x48,
+    0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6,
+    0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x40, 0x53, 0x66, 0x48, 0x0f,
+    0x6e, 0xc8, 0x48, 0x89, 0xfb, 0x66, 0x48, 0x0f, 0x6e, 0xc1, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd0, 0x48, 0x89,
+    0xdf, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2,
+    0x0f, 0x11, 0x04, 0x03, 0x5b, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xe0, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles64[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 37, AUP_HOLE_KC, NULL, 0 },
+    { 72, AUP_HOLE_SYM, (const void *)&pow, 0 },
+    { 87, AUP_HOLE_RA, NULL, 0 },
+    { 103, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode65[] = {
+    0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x0c, 0x17,
+    0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x89,
+    0xc6, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x4b, 0x48, 0x8b, 0x09,
+    0x48, 0x89, 0xce, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x3d, 0x53,
+    0x66, 0x48, 0x0f, 0x6e, 0xc0, 0x48, 0x89, 0xfb, 0x66, 0x48, 0x0f, 0x6e,
+    0xc9, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xd0, 0x48, 0x89, 0xdf, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf2, 0x0f, 0x11, 0x04, 0x03, 0x5b, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x0f, 0x1f, 0x40, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles65[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 75, AUP_HOLE_SYM, (const void *)&pow, 0 },
+    { 90, AUP_HOLE_RA, NULL, 0 },
+    { 106, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode66[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x08, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48,
+    0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x4e, 0x48, 0xa1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6, 0x48,
+    0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x39, 0x53, 0x66, 0x48, 0x0f, 0x6e,
+    0xc8, 0x48, 0x89, 0xfb, 0x66, 0x48, 0x0f, 0x6e, 0xc1, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd0, 0x48, 0x89, 0xdf,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x11, 0x04, 0x03, 0x5b, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xe0, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles66[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 36, AUP_HOLE_KC, NULL, 0 },
+    { 71, AUP_HOLE_SYM, (const void *)&pow, 0 },
+    { 86, AUP_HOLE_RA, NULL, 0 },
+    { 102, AUP_HOLE_NEXT, NULL, 0 },
+    { 114, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode67[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x14, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f,
+    0x48, 0x89, 0xd1, 0x48, 0x21, 0xc1, 0x48, 0x39, 0xc1, 0x74, 0x35, 0x66,
+    0x48, 0x0f, 0x6e, 0xca, 0x66, 0x0f, 0xef, 0xc0, 0xf2, 0x48, 0x0f, 0x2c,
+    0xc1, 0x48, 0xf7, 0xd0, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x04, 0x07,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+    0x0f, 0x1f, 0x40, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles67[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 59, AUP_HOLE_RA, NULL, 0 },
+    { 74, AUP_HOLE_NEXT, NULL, 0 },
+    { 90, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode68[] = {
+    0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x89, 0xc1, 0x48,
+    0x21, 0xd1, 0x48, 0x39, 0xd1, 0x74, 0x31, 0x66, 0x48, 0x0f, 0x6e, 0xc8,
+    0x66, 0x0f, 0xef, 0xc0, 0xf2, 0x48, 0x0f, 0x2c, 0xc1, 0x48, 0xf7, 0xd0,
+    0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x04, 0x07, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles68[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 55, AUP_HOLE_RA, NULL, 0 },
+    { 70, AUP_HOLE_NEXT, NULL, 0 },
+    { 82, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode69[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x0c, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x8d, 0x14, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x7f, 0x48, 0x89, 0xce, 0x48, 0x21, 0xc6, 0x48, 0x39, 0xc6, 0x74,
+    0x4f, 0x48, 0x8b, 0x12, 0x48, 0x89, 0xd6, 0x48, 0x21, 0xc6, 0x48, 0x39,
+    0xc6, 0x74, 0x41, 0x66, 0x48, 0x0f, 0x6e, 0xc9, 0x66, 0x48, 0x0f, 0x6e,
+    0xd2, 0x66, 0x0f, 0xef, 0xc0, 0xf2, 0x48, 0x0f, 0x2c, 0xc1, 0xf2, 0x48,
+    0x0f, 0x2c, 0xd2, 0x48, 0x21, 0xd0, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11,
+    0x04, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles69[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 16, AUP_HOLE_RC, NULL, 0 },
+    { 97, AUP_HOLE_RA, NULL, 0 },
+    { 112, AUP_HOLE_NEXT, NULL, 0 },
+    { 130, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode70[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x8b, 0x0c, 0x07,
+    0x48, 0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x55, 0x48,
+    0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6,
+    0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x40, 0x66, 0x48, 0x0f, 0x6e,
+    0xc9, 0x66, 0x48, 0x0f, 0x6e, 0xd0, 0x66, 0x0f, 0xef, 0xc0, 0xf2, 0x48,
+    0x0f, 0x2c, 0xc2, 0xf2, 0x48, 0x0f, 0x2c, 0xd1, 0x48, 0x21, 0xc2, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f,
+    0x2a, 0xc2, 0xf2, 0x0f, 0x11, 0x04, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles70[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 37, AUP_HOLE_KC, NULL, 0 },
+    { 85, AUP_HOLE_RA, NULL, 0 },
+    { 105, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode71[] = {
+    0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x0c, 0x17,
+    0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x89,
+    0xc6, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x53, 0x48, 0x8b, 0x09,
+    0x48, 0x89, 0xce, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x45, 0x66,
+    0x48, 0x0f, 0x6e, 0xc8, 0x66, 0x48, 0x0f, 0x6e, 0xd1, 0x66, 0x0f, 0xef,
+    0xc0, 0xf2, 0x48, 0x0f, 0x2c, 0xc1, 0xf2, 0x48, 0x0f, 0x2c, 0xd2, 0x48,
+    0x21, 0xd0, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x04, 0x07, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x66, 0x2e,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles71[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 93, AUP_HOLE_RA, NULL, 0 },
+    { 108, AUP_HOLE_NEXT, NULL, 0 },
+    { 130, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode72[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x08, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48,
+    0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x56, 0x48, 0xa1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6, 0x48,
+    0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x41, 0x66, 0x48, 0x0f, 0x6e, 0xc9,
+    0x66, 0x48, 0x0f, 0x6e, 0xd0, 0x66, 0x0f, 0xef, 0xc0, 0xf2, 0x48, 0x0f,
+    0x2c, 0xc2, 0xf2, 0x48, 0x0f, 0x2c, 0xd1, 0x48, 0x21, 0xc2, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2a,
+    0xc2, 0xf2, 0x0f, 0x11, 0x04, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles72[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 36, AUP_HOLE_KC, NULL, 0 },
+    { 84, AUP_HOLE_RA, NULL, 0 },
+    { 104, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode73[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x0c, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x8d, 0x14, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x7f, 0x48, 0x89, 0xce, 0x48, 0x21, 0xc6, 0x48, 0x39, 0xc6, 0x74,
+    0x4f, 0x48, 0x8b, 0x12, 0x48, 0x89, 0xd6, 0x48, 0x21, 0xc6, 0x48, 0x39,
+    0xc6, 0x74, 0x41, 0x66, 0x48, 0x0f, 0x6e, 0xc9, 0x66, 0x48, 0x0f, 0x6e,
+    0xd2, 0x66, 0x0f, 0xef, 0xc0, 0xf2, 0x48, 0x0f, 0x2c, 0xc1, 0xf2, 0x48,
+    0x0f, 0x2c, 0xd2, 0x48, 0x09, 0xd0, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11,
+    0x04, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles73[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 16, AUP_HOLE_RC, NULL, 0 },
+    { 97, AUP_HOLE_RA, NULL, 0 },
+    { 112, AUP_HOLE_NEXT, NULL, 0 },
+    { 130, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode74[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x8b, 0x0c, 0x07,
+    0x48, 0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x55, 0x48,
+    0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6,
+    0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x40, 0x66, 0x48, 0x0f, 0x6e,
+    0xc9, 0x66, 0x48, 0x0f, 0x6e, 0xd0, 0x66, 0x0f, 0xef, 0xc0, 0xf2, 0x48,
+    0x0f, 0x2c, 0xc2, 0xf2, 0x48, 0x0f, 0x2c, 0xd1, 0x48, 0x09, 0xc2, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f,
+    0x2a, 0xc2, 0xf2, 0x0f, 0x11, 0x04, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles74[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 37, AUP_HOLE_KC, NULL, 0 },
+    { 85, AUP_HOLE_RA, NULL, 0 },
+    { 105, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode75[] = {
+    0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x0c, 0x17,
+    0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x89,
+    0xc6, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x53, 0x48, 0x8b, 0x09,
+    0x48, 0x89, 0xce, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x45, 0x66,
+    0x48, 0x0f, 0x6e, 0xc8, 0x66, 0x48, 0x0f, 0x6e, 0xd1, 0x66, 0x0f, 0xef,
+    0xc0, 0xf2, 0x48, 0x0f, 0x2c, 0xc1, 0xf2, 0x48, 0x0f, 0x2c, 0xd2, 0x48,
+    0x09, 0xd0, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x04, 0x07, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x66, 0x2e,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles75[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 93, AUP_HOLE_RA, NULL, 0 },
+    { 108, AUP_HOLE_NEXT, NULL, 0 },
+    { 130, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode76[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x08, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48,
+    0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x56, 0x48, 0xa1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6, 0x48,
+    0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x41, 0x66, 0x48, 0x0f, 0x6e, 0xc9,
+    0x66, 0x48, 0x0f, 0x6e, 0xd0, 0x66, 0x0f, 0xef, 0xc0, 0xf2, 0x48, 0x0f,
+    0x2c, 0xc2, 0xf2, 0x48, 0x0f, 0x2c, 0xd1, 0x48, 0x09, 0xc2, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2a,
+    0xc2, 0xf2, 0x0f, 0x11, 0x04, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles76[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 36, AUP_HOLE_KC, NULL, 0 },
+    { 84, AUP_HOLE_RA, NULL, 0 },
+    { 104, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode77[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x0c, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x8d, 0x14, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x7f, 0x48, 0x89, 0xce, 0x48, 0x21, 0xc6, 0x48, 0x39, 0xc6, 0x74,
+    0x4f, 0x48, 0x8b, 0x12, 0x48, 0x89, 0xd6, 0x48, 0x21, 0xc6, 0x48, 0x39,
+    0xc6, 0x74, 0x41, 0x66, 0x48, 0x0f, 0x6e, 0xc9, 0x66, 0x48, 0x0f, 0x6e,
+    0xd2, 0x66, 0x0f, 0xef, 0xc0, 0xf2, 0x48, 0x0f, 0x2c, 0xc1, 0xf2, 0x48,
+    0x0f, 0x2c, 0xd2, 0x48, 0x31, 0xd0, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11,
+    0x04, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles77[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 16, AUP_HOLE_RC, NULL, 0 },
+    { 97, AUP_HOLE_RA, NULL, 0 },
+    { 112, AUP_HOLE_NEXT, NULL, 0 },
+    { 130, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode78[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x8b, 0x0c, 0x07,
+    0x48, 0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x55, 0x48,
+    0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6,
+    0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x40, 0x66, 0x48, 0x0f, 0x6e,
+    0xc9, 0x66, 0x48, 0x0f, 0x6e, 0xd0, 0x66, 0x0f, 0xef, 0xc0, 0xf2, 0x48,
+    0x0f, 0x2c, 0xc2, 0xf2, 0x48, 0x0f, 0x2c, 0xd1, 0x48, 0x31, 0xc2, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f,
+    0x2a, 0xc2, 0xf2, 0x0f, 0x11, 0x04, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles78[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 37, AUP_HOLE_KC, NULL, 0 },
+    { 85, AUP_HOLE_RA, NULL, 0 },
+    { 105, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode79[] = {
+    0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x0c, 0x17,
+    0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x89,
+    0xc6, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x53, 0x48, 0x8b, 0x09,
+    0x48, 0x89, 0xce, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x45, 0x66,
+    0x48, 0x0f, 0x6e, 0xc8, 0x66, 0x48, 0x0f, 0x6e, 0xd1, 0x66, 0x0f, 0xef,
+    0xc0, 0xf2, 0x48, 0x0f, 0x2c, 0xc1, 0xf2, 0x48, 0x0f, 0x2c, 0xd2, 0x48,
+    0x31, 0xd0, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x04, 0x07, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x66, 0x2e,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles79[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 93, AUP_HOLE_RA, NULL, 0 },
+    { 108, AUP_HOLE_NEXT, NULL, 0 },
+    { 130, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode80[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x08, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48,
+    0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x56, 0x48, 0xa1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6, 0x48,
+    0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x41, 0x66, 0x48, 0x0f, 0x6e, 0xc9,
+    0x66, 0x48, 0x0f, 0x6e, 0xd0, 0x66, 0x0f, 0xef, 0xc0, 0xf2, 0x48, 0x0f,
+    0x2c, 0xc2, 0xf2, 0x48, 0x0f, 0x2c, 0xd1, 0x48, 0x31, 0xc2, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2a,
+    0xc2, 0xf2, 0x0f, 0x11, 0x04, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles80[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 36, AUP_HOLE_KC, NULL, 0 },
+    { 84, AUP_HOLE_RA, NULL, 0 },
+    { 104, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode81[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x0c, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x8d, 0x14, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x7f, 0x48, 0x89, 0xce, 0x48, 0x21, 0xc6, 0x48, 0x39, 0xc6, 0x74,
+    0x4f, 0x48, 0x8b, 0x12, 0x48, 0x89, 0xd6, 0x48, 0x21, 0xc6, 0x48, 0x39,
+    0xc6, 0x74, 0x41, 0x66, 0x48, 0x0f, 0x6e, 0xc9, 0x66, 0x48, 0x0f, 0x6e,
+    0xd2, 0x66, 0x0f, 0xef, 0xc0, 0xf2, 0x48, 0x0f, 0x2c, 0xc1, 0xf2, 0x48,
+    0x0f, 0x2c, 0xca, 0x48, 0xd3, 0xe0, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11,
+    0x04, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles81[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 16, AUP_HOLE_RC, NULL, 0 },
+    { 97, AUP_HOLE_RA, NULL, 0 },
+    { 112, AUP_HOLE_NEXT, NULL, 0 },
+    { 130, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode82[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x8b, 0x0c, 0x07,
+    0x48, 0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x55, 0x48,
+    0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6,
+    0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x40, 0x66, 0x48, 0x0f, 0x6e,
+    0xc9, 0x66, 0x48, 0x0f, 0x6e, 0xd0, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2c,
+    0xd1, 0xf2, 0x48, 0x0f, 0x2c, 0xca, 0x48, 0xd3, 0xe2, 0xf2, 0x48, 0x0f,
+    0x2a, 0xc2, 0xf2, 0x0f, 0x11, 0x04, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles82[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 37, AUP_HOLE_KC, NULL, 0 },
+    { 72, AUP_HOLE_RA, NULL, 0 },
+    { 105, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode83[] = {
+    0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x0c, 0x17,
+    0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x89,
+    0xc6, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x53, 0x48, 0x8b, 0x09,
+    0x48, 0x89, 0xce, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x45, 0x66,
+    0x48, 0x0f, 0x6e, 0xc8, 0x66, 0x48, 0x0f, 0x6e, 0xd1, 0x66, 0x0f, 0xef,
+    0xc0, 0xf2, 0x48, 0x0f, 0x2c, 0xc1, 0xf2, 0x48, 0x0f, 0x2c, 0xca, 0x48,
+    0xd3, 0xe0, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x04, 0x07, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x66, 0x2e,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles83[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 93, AUP_HOLE_RA, NULL, 0 },
+    { 108, AUP_HOLE_NEXT, NULL, 0 },
+    { 130, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode84[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x08, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48,
+    0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x56, 0x48, 0xa1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6, 0x48,
+    0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x41, 0x66, 0x48, 0x0f, 0x6e, 0xc9,
+    0x66, 0x48, 0x0f, 0x6e, 0xd0, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2c, 0xd1,
+    0xf2, 0x48, 0x0f, 0x2c, 0xca, 0x48, 0xd3, 0xe2, 0xf2, 0x48, 0x0f, 0x2a,
+    0xc2, 0xf2, 0x0f, 0x11, 0x04, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles84[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 36, AUP_HOLE_KC, NULL, 0 },
+    { 71, AUP_HOLE_RA, NULL, 0 },
+    { 104, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode85[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x0c, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x8d, 0x14, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x7f, 0x48, 0x89, 0xce, 0x48, 0x21, 0xc6, 0x48, 0x39, 0xc6, 0x74,
+    0x4f, 0x48, 0x8b, 0x12, 0x48, 0x89, 0xd6, 0x48, 0x21, 0xc6, 0x48, 0x39,
+    0xc6, 0x74, 0x41, 0x66, 0x48, 0x0f, 0x6e, 0xc9, 0x66, 0x48, 0x0f, 0x6e,
+    0xd2, 0x66, 0x0f, 0xef, 0xc0, 0xf2, 0x48, 0x0f, 0x2c, 0xc1, 0xf2, 0x48,
+    0x0f, 0x2c, 0xca, 0x48, 0xd3, 0xf8, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11,
+    0x04, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles85[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 16, AUP_HOLE_RC, NULL, 0 },
+    { 97, AUP_HOLE_RA, NULL, 0 },
+    { 112, AUP_HOLE_NEXT, NULL, 0 },
+    { 130, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode86[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x8b, 0x0c, 0x07,
+    0x48, 0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x55, 0x48,
+    0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6,
+    0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x40, 0x66, 0x48, 0x0f, 0x6e,
+    0xc9, 0x66, 0x48, 0x0f, 0x6e, 0xd0, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2c,
+    0xd1, 0xf2, 0x48, 0x0f, 0x2c, 0xca, 0x48, 0xd3, 0xfa, 0xf2, 0x48, 0x0f,
+    0x2a, 0xc2, 0xf2, 0x0f, 0x11, 0x04, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles86[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 37, AUP_HOLE_KC, NULL, 0 },
+    { 72, AUP_HOLE_RA, NULL, 0 },
+    { 105, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode87[] = {
+    0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x0c, 0x17,
+    0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48, 0x89,
+    0xc6, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x53, 0x48, 0x8b, 0x09,
+    0x48, 0x89, 0xce, 0x48, 0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x45, 0x66,
+    0x48, 0x0f, 0x6e, 0xc8, 0x66, 0x48, 0x0f, 0x6e, 0xd1, 0x66, 0x0f, 0xef,
+    0xc0, 0xf2, 0x48, 0x0f, 0x2c, 0xc1, 0xf2, 0x48, 0x0f, 0x2c, 0xca, 0x48,
+    0xd3, 0xf8, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x04, 0x07, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x66, 0x2e,
+    0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles87[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 93, AUP_HOLE_RA, NULL, 0 },
+    { 108, AUP_HOLE_NEXT, NULL, 0 },
+    { 130, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode88[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x08, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x48,
+    0x89, 0xc8, 0x48, 0x21, 0xd0, 0x48, 0x39, 0xd0, 0x74, 0x56, 0x48, 0xa1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc6, 0x48,
+    0x21, 0xd6, 0x48, 0x39, 0xd6, 0x74, 0x41, 0x66, 0x48, 0x0f, 0x6e, 0xc9,
+    0x66, 0x48, 0x0f, 0x6e, 0xd0, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2c, 0xd1,
+    0xf2, 0x48, 0x0f, 0x2c, 0xca, 0x48, 0xd3, 0xfa, 0xf2, 0x48, 0x0f, 0x2a,
+    0xc2, 0xf2, 0x0f, 0x11, 0x04, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles88[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 36, AUP_HOLE_KC, NULL, 0 },
+    { 71, AUP_HOLE_RA, NULL, 0 },
+    { 104, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode89[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x14, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x14, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles89[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 16, AUP_HOLE_RA, NULL, 0 },
+    { 30, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode90[] = {
+    0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x17,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles90[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 12, AUP_HOLE_RA, NULL, 0 },
+    { 26, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode91[] = {
+    0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x04, 0x17,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles91[] = {
+    { 2, AUP_HOLE_GLOBAL, NULL, 0 },
+    { 12, AUP_HOLE_RA, NULL, 0 },
+    { 26, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode92[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x8b,
+    0x14, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0x10, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles92[] = {
+    { 2, AUP_HOLE_RC, NULL, 0 },
+    { 16, AUP_HOLE_GLOBAL, NULL, 0 },
+    { 29, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode93[] = {
+    0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x02, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles93[] = {
+    { 2, AUP_HOLE_KC, NULL, 0 },
+    { 12, AUP_HOLE_GLOBAL, NULL, 0 },
+    { 25, AUP_HOLE_NEXT, NULL, 0 },
+};
+
+static const aupStencil aup_stencils[AUP_STENCIL_COUNT][4] = {
+    [AUP_STENCIL_EXIT] = {
+        { aup_stencilCode0, 11, 0, NULL, 0, aup_stencilHoles0, 1 },
+        { aup_stencilCode0, 11, 0, NULL, 0, aup_stencilHoles0, 1 },
+        { aup_stencilCode0, 11, 0, NULL, 0, aup_stencilHoles0, 1 },
+        { aup_stencilCode0, 11, 0, NULL, 0, aup_stencilHoles0, 1 },
+    },
+    [AUP_STENCIL_NOP] = {
+        { aup_stencilCode1, 12, 2, NULL, 0, aup_stencilHoles1, 1 },
+        { aup_stencilCode1, 12, 2, NULL, 0, aup_stencilHoles1, 1 },
+        { aup_stencilCode1, 12, 2, NULL, 0, aup_stencilHoles1, 1 },
+        { aup_stencilCode1, 12, 2, NULL, 0, aup_stencilHoles1, 1 },
+    },
+    [AUP_STENCIL_NIL] = {
+        { aup_stencilCode2, 36, 2, NULL, 0, aup_stencilHoles2, 2 },
+        { aup_stencilCode2, 36, 2, NULL, 0, aup_stencilHoles2, 2 },
+        { aup_stencilCode2, 36, 2, NULL, 0, aup_stencilHoles2, 2 },
+        { aup_stencilCode2, 36, 2, NULL, 0, aup_stencilHoles2, 2 },
+    },
+    [AUP_STENCIL_BOOL] = {
+        { aup_stencilCode3, 54, 2, NULL, 0, aup_stencilHoles3, 3 },
+        { aup_stencilCode3, 54, 2, NULL, 0, aup_stencilHoles3, 3 },
+        { aup_stencilCode3, 54, 2, NULL, 0, aup_stencilHoles3, 3 },
+        { aup_stencilCode3, 54, 2, NULL, 0, aup_stencilHoles3, 3 },
+    },
+    [AUP_STENCIL_JMPF] = {
+        { aup_stencilCode4, 95, 2, NULL, 0, aup_stencilHoles4, 3 },
+        { aup_stencilCode5, 95, 2, NULL, 0, aup_stencilHoles5, 3 },
+        { aup_stencilCode4, 95, 2, NULL, 0, aup_stencilHoles4, 3 },
+        { aup_stencilCode5, 95, 2, NULL, 0, aup_stencilHoles5, 3 },
+    },
+    [AUP_STENCIL_JNE] = {
+        { aup_stencilCode6, 207, 0, NULL, 0, aup_stencilHoles6, 5 },
+        { aup_stencilCode6, 207, 0, NULL, 0, aup_stencilHoles6, 5 },
+        { aup_stencilCode6, 207, 0, NULL, 0, aup_stencilHoles6, 5 },
+        { aup_stencilCode6, 207, 0, NULL, 0, aup_stencilHoles6, 5 },
+    },
+    [AUP_STENCIL_JLT] = {
+        { aup_stencilCode7, 147, 0, NULL, 0, aup_stencilHoles7, 6 },
+        { aup_stencilCode8, 139, 0, NULL, 0, aup_stencilHoles8, 6 },
+        { aup_stencilCode9, 147, 0, NULL, 0, aup_stencilHoles9, 6 },
+        { aup_stencilCode10, 139, 0, NULL, 0, aup_stencilHoles10, 6 },
+    },
+    [AUP_STENCIL_JLE] = {
+        { aup_stencilCode11, 147, 0, NULL, 0, aup_stencilHoles11, 6 },
+        { aup_stencilCode12, 139, 0, NULL, 0, aup_stencilHoles12, 6 },
+        { aup_stencilCode13, 147, 0, NULL, 0, aup_stencilHoles13, 6 },
+        { aup_stencilCode14, 139, 0, NULL, 0, aup_stencilHoles14, 6 },
+    },
+    [AUP_STENCIL_JEQ] = {
+        { aup_stencilCode15, 155, 0, NULL, 0, aup_stencilHoles15, 6 },
+        { aup_stencilCode16, 155, 0, NULL, 0, aup_stencilHoles16, 6 },
+        { aup_stencilCode17, 155, 0, NULL, 0, aup_stencilHoles17, 6 },
+        { aup_stencilCode18, 155, 0, NULL, 0, aup_stencilHoles18, 6 },
+    },
+    [AUP_STENCIL_NOT] = {
+        { aup_stencilCode19, 134, 0, NULL, 0, aup_stencilHoles19, 3 },
+        { aup_stencilCode19, 134, 0, NULL, 0, aup_stencilHoles19, 3 },
+        { aup_stencilCode20, 126, 0, NULL, 0, aup_stencilHoles20, 3 },
+        { aup_stencilCode20, 126, 0, NULL, 0, aup_stencilHoles20, 3 },
+    },
+    [AUP_STENCIL_LT] = {
+        { aup_stencilCode21, 139, 0, NULL, 0, aup_stencilHoles21, 5 },
+        { aup_stencilCode22, 131, 0, NULL, 0, aup_stencilHoles22, 5 },
+        { aup_stencilCode23, 131, 0, NULL, 0, aup_stencilHoles23, 5 },
+        { aup_stencilCode24, 131, 0, NULL, 0, aup_stencilHoles24, 5 },
+    },
+    [AUP_STENCIL_LE] = {
+        { aup_stencilCode25, 139, 0, NULL, 0, aup_stencilHoles25, 5 },
+        { aup_stencilCode26, 131, 0, NULL, 0, aup_stencilHoles26, 5 },
+        { aup_stencilCode27, 131, 0, NULL, 0, aup_stencilHoles27, 5 },
+        { aup_stencilCode28, 131, 0, NULL, 0, aup_stencilHoles28, 5 },
+    },
+    [AUP_STENCIL_GT] = {
+        { aup_stencilCode29, 139, 0, NULL, 0, aup_stencilHoles29, 5 },
+        { aup_stencilCode30, 131, 0, NULL, 0, aup_stencilHoles30, 5 },
+        { aup_stencilCode31, 131, 0, NULL, 0, aup_stencilHoles31, 5 },
+        { aup_stencilCode32, 131, 0, NULL, 0, aup_stencilHoles32, 5 },
+    },
+    [AUP_STENCIL_GE] = {
+        { aup_stencilCode33, 139, 0, NULL, 0, aup_stencilHoles33, 5 },
+        { aup_stencilCode34, 131, 0, NULL, 0, aup_stencilHoles34, 5 },
+        { aup_stencilCode35, 131, 0, NULL, 0, aup_stencilHoles35, 5 },
+        { aup_stencilCode36, 131, 0, NULL, 0, aup_stencilHoles36, 5 },
+    },
+    [AUP_STENCIL_EQ] = {
+        { aup_stencilCode37, 171, 0, NULL, 0, aup_stencilHoles37, 5 },
+        { aup_stencilCode38, 171, 0, NULL, 0, aup_stencilHoles38, 5 },
+        { aup_stencilCode39, 171, 0, NULL, 0, aup_stencilHoles39, 5 },
+        { aup_stencilCode40, 163, 0, NULL, 0, aup_stencilHoles40, 5 },
+    },
+    [AUP_STENCIL_NEG] = {
+        { aup_stencilCode41, 99, 0, aup_stencilData41, 16, aup_stencilHoles41, 5 },
+        { aup_stencilCode41, 99, 0, aup_stencilData41, 16, aup_stencilHoles41, 5 },
+        { aup_stencilCode42, 91, 0, aup_stencilData42, 16, aup_stencilHoles42, 5 },
+        { aup_stencilCode42, 91, 0, aup_stencilData42, 16, aup_stencilHoles42, 5 },
+    },
+    [AUP_STENCIL_ADD] = {
+        { aup_stencilCode43, 123, 0, NULL, 0, aup_stencilHoles43, 5 },
+        { aup_stencilCode44, 115, 0, NULL, 0, aup_stencilHoles44, 5 },
+        { aup_stencilCode45, 115, 0, NULL, 0, aup_stencilHoles45, 5 },
+        { aup_stencilCode46, 107, 0, NULL, 0, aup_stencilHoles46, 5 },
+    },
+    [AUP_STENCIL_SUB] = {
+        { aup_stencilCode47, 123, 0, NULL, 0, aup_stencilHoles47, 5 },
+        { aup_stencilCode48, 115, 0, NULL, 0, aup_stencilHoles48, 5 },
+        { aup_stencilCode49, 115, 0, NULL, 0, aup_stencilHoles49, 5 },
+        { aup_stencilCode50, 107, 0, NULL, 0, aup_stencilHoles50, 5 },
+    },
+    [AUP_STENCIL_MUL] = {
+        { aup_stencilCode51, 123, 0, NULL, 0, aup_stencilHoles51, 5 },
+        { aup_stencilCode52, 115, 0, NULL, 0, aup_stencilHoles52, 5 },
+        { aup_stencilCode53, 115, 0, NULL, 0, aup_stencilHoles53, 5 },
+        { aup_stencilCode54, 107, 0, NULL, 0, aup_stencilHoles54, 5 },
+    },
+    [AUP_STENCIL_DIV] = {
+        { aup_stencilCode55, 123, 0, NULL, 0, aup_stencilHoles55, 5 },
+        { aup_stencilCode56, 115, 0, NULL, 0, aup_stencilHoles56, 5 },
+        { aup_stencilCode57, 115, 0, NULL, 0, aup_stencilHoles57, 5 },
+        { aup_stencilCode58, 107, 0, NULL, 0, aup_stencilHoles58, 5 },
+    },
+    [AUP_STENCIL_MOD] = {
+        { aup_stencilCode59, 139, 0, NULL, 0, aup_stencilHoles59, 6 },
+        { aup_stencilCode60, 131, 0, NULL, 0, aup_stencilHoles60, 6 },
+        { aup_stencilCode61, 131, 0, NULL, 0, aup_stencilHoles61, 6 },
+        { aup_stencilCode62, 123, 0, NULL, 0, aup_stencilHoles62, 6 },
+    },
+    [AUP_STENCIL_POW] = {
+        { aup_stencilCode63, 139, 0, NULL, 0, aup_stencilHoles63, 6 },
+        { aup_stencilCode64, 131, 0, NULL, 0, aup_stencilHoles64, 6 },
+        { aup_stencilCode65, 131, 0, NULL, 0, aup_stencilHoles65, 6 },
+        { aup_stencilCode66, 123, 0, NULL, 0, aup_stencilHoles66, 6 },
+    },
+    [AUP_STENCIL_BNOT] = {
+        { aup_stencilCode67, 99, 0, NULL, 0, aup_stencilHoles67, 4 },
+        { aup_stencilCode67, 99, 0, NULL, 0, aup_stencilHoles67, 4 },
+        { aup_stencilCode68, 91, 0, NULL, 0, aup_stencilHoles68, 4 },
+        { aup_stencilCode68, 91, 0, NULL, 0, aup_stencilHoles68, 4 },
+    },
+    [AUP_STENCIL_BAND] = {
+        { aup_stencilCode69, 139, 0, NULL, 0, aup_stencilHoles69, 5 },
+        { aup_stencilCode70, 131, 0, NULL, 0, aup_stencilHoles70, 5 },
+        { aup_stencilCode71, 139, 0, NULL, 0, aup_stencilHoles71, 5 },
+        { aup_stencilCode72, 131, 0, NULL, 0, aup_stencilHoles72, 5 },
+    },
+    [AUP_STENCIL_BOR] = {
+        { aup_stencilCode73, 139, 0, NULL, 0, aup_stencilHoles73, 5 },
+        { aup_stencilCode74, 131, 0, NULL, 0, aup_stencilHoles74, 5 },
+        { aup_stencilCode75, 139, 0, NULL, 0, aup_stencilHoles75, 5 },
+        { aup_stencilCode76, 131, 0, NULL, 0, aup_stencilHoles76, 5 },
+    },
+    [AUP_STENCIL_BXOR] = {
+        { aup_stencilCode77, 139, 0, NULL, 0, aup_stencilHoles77, 5 },
+        { aup_stencilCode78, 131, 0, NULL, 0, aup_stencilHoles78, 5 },
+        { aup_stencilCode79, 139, 0, NULL, 0, aup_stencilHoles79, 5 },
+        { aup_stencilCode80, 131, 0, NULL, 0, aup_stencilHoles80, 5 },
+    },
+    [AUP_STENCIL_SHL] = {
+        { aup_stencilCode81, 139, 0, NULL, 0, aup_stencilHoles81, 5 },
+        { aup_stencilCode82, 131, 0, NULL, 0, aup_stencilHoles82, 5 },
+        { aup_stencilCode83, 139, 0, NULL, 0, aup_stencilHoles83, 5 },
+        { aup_stencilCode84, 131, 0, NULL, 0, aup_stencilHoles84, 5 },
+    },
+    [AUP_STENCIL_SHR] = {
+        { aup_stencilCode85, 139, 0, NULL, 0, aup_stencilHoles85, 5 },
+        { aup_stencilCode86, 131, 0, NULL, 0, aup_stencilHoles86, 5 },
+        { aup_stencilCode87, 139, 0, NULL, 0, aup_stencilHoles87, 5 },
+        { aup_stencilCode88, 131, 0, NULL, 0, aup_stencilHoles88, 5 },
+    },
+    [AUP_STENCIL_MOV] = {
+        { aup_stencilCode89, 40, 2, NULL, 0, aup_stencilHoles89, 3 },
+        { aup_stencilCode89, 40, 2, NULL, 0, aup_stencilHoles89, 3 },
+        { aup_stencilCode89, 40, 2, NULL, 0, aup_stencilHoles89, 3 },
+        { aup_stencilCode89, 40, 2, NULL, 0, aup_stencilHoles89, 3 },
+    },
+    [AUP_STENCIL_LD] = {
+        { aup_stencilCode89, 40, 2, NULL, 0, aup_stencilHoles89, 3 },
+        { aup_stencilCode89, 40, 2, NULL, 0, aup_stencilHoles89, 3 },
+        { aup_stencilCode90, 36, 2, NULL, 0, aup_stencilHoles90, 3 },
+        { aup_stencilCode90, 36, 2, NULL, 0, aup_stencilHoles90, 3 },
+    },
+    [AUP_STENCIL_GLD] = {
+        { aup_stencilCode91, 36, 2, NULL, 0, aup_stencilHoles91, 3 },
+        { aup_stencilCode91, 36, 2, NULL, 0, aup_stencilHoles91, 3 },
+        { aup_stencilCode91, 36, 2, NULL, 0, aup_stencilHoles91, 3 },
+        { aup_stencilCode91, 36, 2, NULL, 0, aup_stencilHoles91, 3 },
+    },
+    [AUP_STENCIL_GST] = {
+        { aup_stencilCode92, 39, 2, NULL, 0, aup_stencilHoles92, 3 },
+        { aup_stencilCode93, 35, 2, NULL, 0, aup_stencilHoles93, 3 },
+        { aup_stencilCode92, 39, 2, NULL, 0, aup_stencilHoles92, 3 },
+        { aup_stencilCode93, 35, 2, NULL, 0, aup_stencilHoles93, 3 },
+    },
+};
+
+#else
+
+static const uint8_t aup_stencilCode0[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3,
+};
+static const aupHole aup_stencilHoles0[] = {
+    { 2, AUP_HOLE_PC, NULL, 0 },
+};
+static const uint8_t aup_stencilCode1[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles1[] = {
+    { 2, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode2[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x0f,
+    0xef, 0xc0, 0x0f, 0x11, 0x04, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles2[] = {
+    { 2, AUP_HOLE_RA, NULL, 0 },
+    { 20, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode3[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x0f,
+    0xef, 0xc0, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x01, 0xf8, 0x48, 0x85, 0xd2, 0x0f, 0x11, 0x00, 0x0f, 0xb6, 0x50,
+    0x08, 0x0f, 0x95, 0xc1, 0xc7, 0x00, 0x01, 0x00, 0x00, 0x00, 0x83, 0xe2,
+    0xfe, 0x09, 0xca, 0x88, 0x50, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles3[] = {
+    { 2, AUP_HOLE_RA, NULL, 0 },
+    { 16, AUP_HOLE_IMM, NULL, 0 },
+    { 56, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode4[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83,
+    0x7c, 0x07, 0x08, 0x00, 0x75, 0x0e, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x66, 0x90, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles4[] = {
+    { 2, AUP_HOLE_RC, NULL, 0 },
+    { 20, AUP_HOLE_TARGET, NULL, 0 },
+    { 34, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode5[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83,
+    0x78, 0x08, 0x00, 0x75, 0x0f, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xe0, 0x0f, 0x1f, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles5[] = {
+    { 2, AUP_HOLE_KC, NULL, 0 },
+    { 19, AUP_HOLE_TARGET, NULL, 0 },
+    { 34, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode6[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x48,
+    0x89, 0xfb, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x01, 0xf8, 0x48, 0x01, 0xfa, 0x48, 0x8b, 0x7a, 0x08, 0x48, 0x8b,
+    0x70, 0x08, 0x48, 0x8b, 0x0a, 0x48, 0x33, 0x08, 0x48, 0x31, 0xfe, 0x48,
+    0x09, 0xce, 0x75, 0x14, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0xdf, 0x5b, 0xff, 0xe0, 0x0f, 0x1f, 0x40, 0x00,
+    0x83, 0x3a, 0x03, 0x74, 0x63, 0x83, 0x38, 0x03, 0x48, 0x8b, 0x48, 0x08,
+    0x74, 0x1a, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x89, 0xdf, 0x5b, 0xff, 0xe0, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0xb6, 0x49, 0x07, 0x83, 0xe1, 0x1f, 0x80,
+    0xf9, 0x07, 0x75, 0xda, 0x44, 0x8b, 0x00, 0x48, 0x8b, 0x48, 0x08, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x3a, 0x48,
+    0x8b, 0x72, 0x08, 0x44, 0x89, 0xc2, 0xff, 0xd0, 0x84, 0xc0, 0x75, 0x98,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89,
+    0xdf, 0x5b, 0xff, 0xe0, 0x0f, 0x1f, 0x40, 0x00, 0x0f, 0xb6, 0x4f, 0x07,
+    0x83, 0xe1, 0x1f, 0x80, 0xf9, 0x07, 0x74, 0xc0, 0x83, 0x38, 0x03, 0x48,
+    0x8b, 0x48, 0x08, 0x75, 0x91, 0xeb, 0xa9,
+};
+static const aupHole aup_stencilHoles6[] = {
+    { 2, AUP_HOLE_RC, NULL, 0 },
+    { 16, AUP_HOLE_RB, NULL, 0 },
+    { 54, AUP_HOLE_NEXT, NULL, 0 },
+    { 88, AUP_HOLE_TARGET, NULL, 0 },
+    { 133, AUP_HOLE_SYM, (const void *)&aup_isEqual, 0 },
+    { 158, AUP_HOLE_TARGET, NULL, 0 },
+};
+static const uint8_t aup_stencilCode7[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x48,
+    0x01, 0xfa, 0x83, 0x38, 0x02, 0x75, 0x05, 0x83, 0x3a, 0x02, 0x74, 0x0c,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x90,
+    0xf2, 0x0f, 0x10, 0x42, 0x08, 0x66, 0x0f, 0x2f, 0x40, 0x08, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x1a, 0x48, 0x85,
+    0xc0, 0x75, 0x1b, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xf8, 0x01, 0x74, 0xe5, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles7[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 38, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_IMM, NULL, 0 },
+    { 77, AUP_HOLE_TARGET, NULL, 0 },
+    { 104, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode8[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x83,
+    0x3a, 0x02, 0x75, 0x05, 0x83, 0x38, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0xf2, 0x0f, 0x10, 0x42, 0x08, 0x66, 0x0f, 0x2f, 0x40, 0x08, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x1a, 0x48, 0x85,
+    0xc0, 0x75, 0x1b, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xf8, 0x01, 0x74, 0xe5, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles8[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 12, AUP_HOLE_KC, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_IMM, NULL, 0 },
+    { 77, AUP_HOLE_TARGET, NULL, 0 },
+    { 104, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode9[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01,
+    0xf8, 0x83, 0x38, 0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x83, 0x3a, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0xf2, 0x0f, 0x10, 0x40, 0x08, 0x66, 0x0f, 0x2f, 0x42, 0x08, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x1a, 0x48, 0x85,
+    0xc0, 0x75, 0x1b, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xf8, 0x01, 0x74, 0xe5, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles9[] = {
+    { 2, AUP_HOLE_RC, NULL, 0 },
+    { 20, AUP_HOLE_KB, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_IMM, NULL, 0 },
+    { 77, AUP_HOLE_TARGET, NULL, 0 },
+    { 104, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode10[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x38,
+    0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x83, 0x3a, 0x02, 0x74, 0x12, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0xf2, 0x0f, 0x10, 0x40, 0x08, 0x66, 0x0f, 0x2f, 0x42, 0x08, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x1a, 0x48, 0x85,
+    0xc0, 0x75, 0x1b, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xf8, 0x01, 0x74, 0xe5, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles10[] = {
+    { 2, AUP_HOLE_KC, NULL, 0 },
+    { 17, AUP_HOLE_KB, NULL, 0 },
+    { 32, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_IMM, NULL, 0 },
+    { 77, AUP_HOLE_TARGET, NULL, 0 },
+    { 104, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode11[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x48,
+    0x01, 0xfa, 0x83, 0x38, 0x02, 0x75, 0x05, 0x83, 0x3a, 0x02, 0x74, 0x0c,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x90,
+    0xf2, 0x0f, 0x10, 0x42, 0x08, 0x66, 0x0f, 0x2f, 0x40, 0x08, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x1a, 0x48, 0x85,
+    0xc0, 0x75, 0x1b, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xf8, 0x01, 0x74, 0xe5, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles11[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 38, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_IMM, NULL, 0 },
+    { 77, AUP_HOLE_TARGET, NULL, 0 },
+    { 104, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode12[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x83,
+    0x3a, 0x02, 0x75, 0x05, 0x83, 0x38, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0xf2, 0x0f, 0x10, 0x42, 0x08, 0x66, 0x0f, 0x2f, 0x40, 0x08, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x1a, 0x48, 0x85,
+    0xc0, 0x75, 0x1b, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xf8, 0x01, 0x74, 0xe5, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles12[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 12, AUP_HOLE_KC, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_IMM, NULL, 0 },
+    { 77, AUP_HOLE_TARGET, NULL, 0 },
+    { 104, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode13[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01,
+    0xf8, 0x83, 0x38, 0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x83, 0x3a, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0xf2, 0x0f, 0x10, 0x40, 0x08, 0x66, 0x0f, 0x2f, 0x42, 0x08, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x1a, 0x48, 0x85,
+    0xc0, 0x75, 0x1b, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xf8, 0x01, 0x74, 0xe5, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles13[] = {
+    { 2, AUP_HOLE_RC, NULL, 0 },
+    { 20, AUP_HOLE_KB, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_IMM, NULL, 0 },
+    { 77, AUP_HOLE_TARGET, NULL, 0 },
+    { 104, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode14[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x38,
+    0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x83, 0x3a, 0x02, 0x74, 0x12, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0xf2, 0x0f, 0x10, 0x40, 0x08, 0x66, 0x0f, 0x2f, 0x42, 0x08, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x1a, 0x48, 0x85,
+    0xc0, 0x75, 0x1b, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x83, 0xf8, 0x01, 0x74, 0xe5, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles14[] = {
+    { 2, AUP_HOLE_KC, NULL, 0 },
+    { 17, AUP_HOLE_KB, NULL, 0 },
+    { 32, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_IMM, NULL, 0 },
+    { 77, AUP_HOLE_TARGET, NULL, 0 },
+    { 104, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode15[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x48,
+    0x89, 0xfb, 0x49, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x01, 0xf8, 0x49, 0x01, 0xf8, 0x83, 0x38, 0x02, 0x48, 0x8b, 0x38,
+    0x48, 0x8b, 0x70, 0x08, 0xf2, 0x0f, 0x10, 0x48, 0x08, 0x49, 0x8b, 0x10,
+    0x49, 0x8b, 0x48, 0x08, 0x45, 0x8b, 0x08, 0xf2, 0x41, 0x0f, 0x10, 0x40,
+    0x08, 0x75, 0x06, 0x41, 0x83, 0xf9, 0x02, 0x74, 0x43, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd0, 0x48, 0xba, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xb6, 0xc0, 0x48, 0x89,
+    0xdf, 0x48, 0x39, 0xd0, 0x74, 0x12, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0xe0, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff,
+    0xe0, 0x0f, 0x1f, 0x00, 0x66, 0x0f, 0x2e, 0xc8, 0xba, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0x9b, 0xc0, 0x0f, 0x45, 0xc2, 0xeb, 0xb8,
+};
+static const aupHole aup_stencilHoles15[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 16, AUP_HOLE_RC, NULL, 0 },
+    { 71, AUP_HOLE_SYM, (const void *)&aup_isEqual, 0 },
+    { 83, AUP_HOLE_IMM, NULL, 0 },
+    { 104, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_TARGET, NULL, 0 },
+};
+static const uint8_t aup_stencilCode16[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x48,
+    0x89, 0xfb, 0x49, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x01, 0xf8, 0x49, 0x8b, 0x10, 0x49, 0x8b, 0x48, 0x08, 0x83, 0x38,
+    0x02, 0x48, 0x8b, 0x38, 0x48, 0x8b, 0x70, 0x08, 0xf2, 0x0f, 0x10, 0x48,
+    0x08, 0x45, 0x8b, 0x08, 0xf2, 0x41, 0x0f, 0x10, 0x40, 0x08, 0x75, 0x06,
+    0x41, 0x83, 0xf9, 0x02, 0x74, 0x3e, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xd0, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0xb6, 0xc0, 0x48, 0x89, 0xdf, 0x48, 0x39,
+    0xd0, 0x74, 0x0d, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x5b, 0xff, 0xe0, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x5b, 0xff, 0xe0, 0x0f, 0x1f, 0x00, 0x66, 0x0f, 0x2e, 0xc8,
+    0xba, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x9b, 0xc0, 0x0f, 0x45, 0xc2, 0xeb,
+    0xbd,
+};
+static const aupHole aup_stencilHoles16[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 16, AUP_HOLE_KC, NULL, 0 },
+    { 68, AUP_HOLE_SYM, (const void *)&aup_isEqual, 0 },
+    { 80, AUP_HOLE_IMM, NULL, 0 },
+    { 101, AUP_HOLE_NEXT, NULL, 0 },
+    { 114, AUP_HOLE_TARGET, NULL, 0 },
+};
+static const uint8_t aup_stencilCode17[] = {
+    0x49, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x48,
+    0x89, 0xfb, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x01, 0xf8, 0x41, 0x83, 0x38, 0x02, 0x49, 0x8b, 0x38, 0x49, 0x8b,
+    0x70, 0x08, 0xf2, 0x41, 0x0f, 0x10, 0x48, 0x08, 0x48, 0x8b, 0x10, 0x48,
+    0x8b, 0x48, 0x08, 0x44, 0x8b, 0x08, 0xf2, 0x0f, 0x10, 0x40, 0x08, 0x75,
+    0x06, 0x41, 0x83, 0xf9, 0x02, 0x74, 0x45, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd0, 0x48, 0xba, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xb6, 0xc0, 0x48, 0x89, 0xdf, 0x48,
+    0x39, 0xd0, 0x74, 0x14, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x5b, 0xff, 0xe0, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff,
+    0xe0, 0x0f, 0x1f, 0x00, 0x66, 0x0f, 0x2e, 0xc8, 0xba, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0x9b, 0xc0, 0x0f, 0x45, 0xc2, 0xeb, 0xb6,
+};
+static const aupHole aup_stencilHoles17[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 16, AUP_HOLE_RC, NULL, 0 },
+    { 69, AUP_HOLE_SYM, (const void *)&aup_isEqual, 0 },
+    { 81, AUP_HOLE_IMM, NULL, 0 },
+    { 102, AUP_HOLE_NEXT, NULL, 0 },
+    { 122, AUP_HOLE_TARGET, NULL, 0 },
+};
+static const uint8_t aup_stencilCode18[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x48,
+    0x89, 0xfb, 0x49, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0x38, 0x02, 0x48, 0x8b, 0x38, 0x48, 0x8b, 0x70, 0x08, 0xf2, 0x0f,
+    0x10, 0x48, 0x08, 0x49, 0x8b, 0x10, 0x49, 0x8b, 0x48, 0x08, 0x45, 0x8b,
+    0x08, 0xf2, 0x41, 0x0f, 0x10, 0x40, 0x08, 0x75, 0x06, 0x41, 0x83, 0xf9,
+    0x02, 0x74, 0x41, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xd0, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0xb6, 0xc0, 0x48, 0x89, 0xdf, 0x48, 0x39, 0xd0, 0x74, 0x10,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff,
+    0xe0, 0x0f, 0x1f, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x5b, 0xff, 0xe0, 0x0f, 0x1f, 0x00, 0x66, 0x0f, 0x2e, 0xc8,
+    0xba, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x9b, 0xc0, 0x0f, 0x45, 0xc2, 0xeb,
+    0xba,
+};
+static const aupHole aup_stencilHoles18[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 16, AUP_HOLE_KC, NULL, 0 },
+    { 65, AUP_HOLE_SYM, (const void *)&aup_isEqual, 0 },
+    { 77, AUP_HOLE_IMM, NULL, 0 },
+    { 98, AUP_HOLE_NEXT, NULL, 0 },
+    { 114, AUP_HOLE_TARGET, NULL, 0 },
+};
+static const uint8_t aup_stencilCode19[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x0f,
+    0xef, 0xc0, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x01, 0xf8, 0x48, 0x83, 0x7c, 0x17, 0x08, 0x00, 0x0f, 0x11, 0x00,
+    0x0f, 0xb6, 0x50, 0x08, 0x0f, 0x94, 0xc1, 0xc7, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x83, 0xe2, 0xfe, 0x09, 0xca, 0x88, 0x50, 0x08, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles19[] = {
+    { 2, AUP_HOLE_RA, NULL, 0 },
+    { 16, AUP_HOLE_RB, NULL, 0 },
+    { 59, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode20[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x0f,
+    0xef, 0xc0, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x01, 0xf8, 0x48, 0x83, 0x7a, 0x08, 0x00, 0x0f, 0x11, 0x00, 0x0f,
+    0xb6, 0x50, 0x08, 0x0f, 0x94, 0xc1, 0xc7, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x83, 0xe2, 0xfe, 0x09, 0xca, 0x88, 0x50, 0x08, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles20[] = {
+    { 2, AUP_HOLE_RA, NULL, 0 },
+    { 16, AUP_HOLE_KB, NULL, 0 },
+    { 58, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode21[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x48,
+    0x01, 0xfa, 0x83, 0x38, 0x02, 0x75, 0x05, 0x83, 0x3a, 0x02, 0x74, 0x0c,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x90,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x42, 0x08, 0x48, 0x01, 0xf9, 0x66, 0x0f, 0x2f, 0x40, 0x08, 0x66,
+    0x0f, 0xef, 0xc0, 0x0f, 0x11, 0x01, 0x0f, 0xb6, 0x41, 0x08, 0xc7, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x0f, 0x97, 0xc2, 0x83, 0xe0, 0xfe, 0x09, 0xd0,
+    0x88, 0x41, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles21[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 38, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 101, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode22[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01,
+    0xf8, 0x83, 0x38, 0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x83, 0x3a, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x42, 0x08, 0x48, 0x01, 0xf9, 0x66, 0x0f, 0x2f, 0x40, 0x08, 0x66,
+    0x0f, 0xef, 0xc0, 0x0f, 0x11, 0x01, 0x0f, 0xb6, 0x41, 0x08, 0xc7, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x0f, 0x97, 0xc2, 0x83, 0xe0, 0xfe, 0x09, 0xd0,
+    0x88, 0x41, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles22[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 20, AUP_HOLE_KC, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 101, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode23[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x83,
+    0x3a, 0x02, 0x75, 0x05, 0x83, 0x38, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x40, 0x08, 0x48, 0x01, 0xf9, 0x66, 0x0f, 0x2f, 0x42, 0x08, 0x66,
+    0x0f, 0xef, 0xc0, 0x0f, 0x11, 0x01, 0x0f, 0xb6, 0x41, 0x08, 0xc7, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x0f, 0x97, 0xc2, 0x83, 0xe0, 0xfe, 0x09, 0xd0,
+    0x88, 0x41, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles23[] = {
+    { 2, AUP_HOLE_RC, NULL, 0 },
+    { 12, AUP_HOLE_KB, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 101, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode24[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x38,
+    0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x83, 0x3a, 0x02, 0x74, 0x12, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x40, 0x08, 0x48, 0x01, 0xf9, 0x66, 0x0f, 0x2f, 0x42, 0x08, 0x66,
+    0x0f, 0xef, 0xc0, 0x0f, 0x11, 0x01, 0x0f, 0xb6, 0x41, 0x08, 0xc7, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x0f, 0x97, 0xc2, 0x83, 0xe0, 0xfe, 0x09, 0xd0,
+    0x88, 0x41, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles24[] = {
+    { 2, AUP_HOLE_KC, NULL, 0 },
+    { 17, AUP_HOLE_KB, NULL, 0 },
+    { 32, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 101, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode25[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x48,
+    0x01, 0xfa, 0x83, 0x38, 0x02, 0x75, 0x05, 0x83, 0x3a, 0x02, 0x74, 0x0c,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x90,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x42, 0x08, 0x48, 0x01, 0xf9, 0x66, 0x0f, 0x2f, 0x40, 0x08, 0x66,
+    0x0f, 0xef, 0xc0, 0x0f, 0x11, 0x01, 0x0f, 0xb6, 0x41, 0x08, 0xc7, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x0f, 0x93, 0xc2, 0x83, 0xe0, 0xfe, 0x09, 0xd0,
+    0x88, 0x41, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles25[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 38, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 101, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode26[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01,
+    0xf8, 0x83, 0x38, 0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x83, 0x3a, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x42, 0x08, 0x48, 0x01, 0xf9, 0x66, 0x0f, 0x2f, 0x40, 0x08, 0x66,
+    0x0f, 0xef, 0xc0, 0x0f, 0x11, 0x01, 0x0f, 0xb6, 0x41, 0x08, 0xc7, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x0f, 0x93, 0xc2, 0x83, 0xe0, 0xfe, 0x09, 0xd0,
+    0x88, 0x41, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles26[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 20, AUP_HOLE_KC, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 101, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode27[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x83,
+    0x3a, 0x02, 0x75, 0x05, 0x83, 0x38, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x40, 0x08, 0x48, 0x01, 0xf9, 0x66, 0x0f, 0x2f, 0x42, 0x08, 0x66,
+    0x0f, 0xef, 0xc0, 0x0f, 0x11, 0x01, 0x0f, 0xb6, 0x41, 0x08, 0xc7, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x0f, 0x93, 0xc2, 0x83, 0xe0, 0xfe, 0x09, 0xd0,
+    0x88, 0x41, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles27[] = {
+    { 2, AUP_HOLE_RC, NULL, 0 },
+    { 12, AUP_HOLE_KB, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 101, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode28[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x38,
+    0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x83, 0x3a, 0x02, 0x74, 0x12, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x40, 0x08, 0x48, 0x01, 0xf9, 0x66, 0x0f, 0x2f, 0x42, 0x08, 0x66,
+    0x0f, 0xef, 0xc0, 0x0f, 0x11, 0x01, 0x0f, 0xb6, 0x41, 0x08, 0xc7, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x0f, 0x93, 0xc2, 0x83, 0xe0, 0xfe, 0x09, 0xd0,
+    0x88, 0x41, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles28[] = {
+    { 2, AUP_HOLE_KC, NULL, 0 },
+    { 17, AUP_HOLE_KB, NULL, 0 },
+    { 32, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 101, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode29[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x48,
+    0x01, 0xfa, 0x83, 0x38, 0x02, 0x75, 0x05, 0x83, 0x3a, 0x02, 0x74, 0x0c,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x90,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x40, 0x08, 0x48, 0x01, 0xf9, 0x66, 0x0f, 0x2f, 0x42, 0x08, 0x66,
+    0x0f, 0xef, 0xc0, 0x0f, 0x11, 0x01, 0x0f, 0xb6, 0x41, 0x08, 0xc7, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x0f, 0x97, 0xc2, 0x83, 0xe0, 0xfe, 0x09, 0xd0,
+    0x88, 0x41, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles29[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 38, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 101, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode30[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01,
+    0xf8, 0x83, 0x38, 0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x83, 0x3a, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x40, 0x08, 0x48, 0x01, 0xf9, 0x66, 0x0f, 0x2f, 0x42, 0x08, 0x66,
+    0x0f, 0xef, 0xc0, 0x0f, 0x11, 0x01, 0x0f, 0xb6, 0x41, 0x08, 0xc7, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x0f, 0x97, 0xc2, 0x83, 0xe0, 0xfe, 0x09, 0xd0,
+    0x88, 0x41, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles30[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 20, AUP_HOLE_KC, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 101, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode31[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x83,
+    0x3a, 0x02, 0x75, 0x05, 0x83, 0x38, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x42, 0x08, 0x48, 0x01, 0xf9, 0x66, 0x0f, 0x2f, 0x40, 0x08, 0x66,
+    0x0f, 0xef, 0xc0, 0x0f, 0x11, 0x01, 0x0f, 0xb6, 0x41, 0x08, 0xc7, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x0f, 0x97, 0xc2, 0x83, 0xe0, 0xfe, 0x09, 0xd0,
+    0x88, 0x41, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles31[] = {
+    { 2, AUP_HOLE_RC, NULL, 0 },
+    { 12, AUP_HOLE_KB, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 101, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode32[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x38,
+    0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x83, 0x3a, 0x02, 0x74, 0x12, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x42, 0x08, 0x48, 0x01, 0xf9, 0x66, 0x0f, 0x2f, 0x40, 0x08, 0x66,
+    0x0f, 0xef, 0xc0, 0x0f, 0x11, 0x01, 0x0f, 0xb6, 0x41, 0x08, 0xc7, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x0f, 0x97, 0xc2, 0x83, 0xe0, 0xfe, 0x09, 0xd0,
+    0x88, 0x41, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles32[] = {
+    { 2, AUP_HOLE_KC, NULL, 0 },
+    { 17, AUP_HOLE_KB, NULL, 0 },
+    { 32, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 101, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode33[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x48,
+    0x01, 0xfa, 0x83, 0x38, 0x02, 0x75, 0x05, 0x83, 0x3a, 0x02, 0x74, 0x0c,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x90,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x40, 0x08, 0x48, 0x01, 0xf9, 0x66, 0x0f, 0x2f, 0x42, 0x08, 0x66,
+    0x0f, 0xef, 0xc0, 0x0f, 0x11, 0x01, 0x0f, 0xb6, 0x41, 0x08, 0xc7, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x0f, 0x93, 0xc2, 0x83, 0xe0, 0xfe, 0x09, 0xd0,
+    0x88, 0x41, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles33[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 38, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 101, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode34[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01,
+    0xf8, 0x83, 0x38, 0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x83, 0x3a, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x40, 0x08, 0x48, 0x01, 0xf9, 0x66, 0x0f, 0x2f, 0x42, 0x08, 0x66,
+    0x0f, 0xef, 0xc0, 0x0f, 0x11, 0x01, 0x0f, 0xb6, 0x41, 0x08, 0xc7, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x0f, 0x93, 0xc2, 0x83, 0xe0, 0xfe, 0x09, 0xd0,
+    0x88, 0x41, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles34[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 20, AUP_HOLE_KC, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 101, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode35[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x83,
+    0x3a, 0x02, 0x75, 0x05, 0x83, 0x38, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x42, 0x08, 0x48, 0x01, 0xf9, 0x66, 0x0f, 0x2f, 0x40, 0x08, 0x66,
+    0x0f, 0xef, 0xc0, 0x0f, 0x11, 0x01, 0x0f, 0xb6, 0x41, 0x08, 0xc7, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x0f, 0x93, 0xc2, 0x83, 0xe0, 0xfe, 0x09, 0xd0,
+    0x88, 0x41, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles35[] = {
+    { 2, AUP_HOLE_RC, NULL, 0 },
+    { 12, AUP_HOLE_KB, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 101, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode36[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x38,
+    0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x83, 0x3a, 0x02, 0x74, 0x12, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x42, 0x08, 0x48, 0x01, 0xf9, 0x66, 0x0f, 0x2f, 0x40, 0x08, 0x66,
+    0x0f, 0xef, 0xc0, 0x0f, 0x11, 0x01, 0x0f, 0xb6, 0x41, 0x08, 0xc7, 0x01,
+    0x01, 0x00, 0x00, 0x00, 0x0f, 0x93, 0xc2, 0x83, 0xe0, 0xfe, 0x09, 0xd0,
+    0x88, 0x41, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles36[] = {
+    { 2, AUP_HOLE_KC, NULL, 0 },
+    { 17, AUP_HOLE_KB, NULL, 0 },
+    { 32, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 101, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode37[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x49,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xbd, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x48, 0x01, 0xf8, 0x49,
+    0x01, 0xf8, 0x48, 0x01, 0xfd, 0x48, 0x89, 0xfb, 0x48, 0x83, 0xec, 0x08,
+    0x83, 0x38, 0x02, 0x48, 0x8b, 0x38, 0x48, 0x8b, 0x70, 0x08, 0xf2, 0x0f,
+    0x10, 0x48, 0x08, 0x49, 0x8b, 0x10, 0x49, 0x8b, 0x48, 0x08, 0x45, 0x8b,
+    0x08, 0xf2, 0x41, 0x0f, 0x10, 0x40, 0x08, 0x75, 0x06, 0x41, 0x83, 0xf9,
+    0x02, 0x74, 0x39, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xd0, 0x83, 0xe0, 0x01, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0x89,
+    0xdf, 0x0f, 0x11, 0x45, 0x00, 0x88, 0x45, 0x08, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x45, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x48, 0x83, 0xc4, 0x08, 0x5b, 0x5d, 0xff, 0xe0, 0x0f, 0x1f, 0x00,
+    0x66, 0x0f, 0x2e, 0xc8, 0xba, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x9b, 0xc0,
+    0x0f, 0x45, 0xc2, 0xeb, 0xc2,
+};
+static const aupHole aup_stencilHoles37[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 13, AUP_HOLE_RC, NULL, 0 },
+    { 23, AUP_HOLE_RA, NULL, 0 },
+    { 89, AUP_HOLE_SYM, (const void *)&aup_isEqual, 0 },
+    { 118, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode38[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x48, 0x01, 0xf8, 0x48,
+    0x01, 0xfd, 0x48, 0x89, 0xfb, 0x48, 0x83, 0xec, 0x08, 0x83, 0x38, 0x02,
+    0x48, 0x8b, 0x38, 0x48, 0x8b, 0x70, 0x08, 0xf2, 0x0f, 0x10, 0x48, 0x08,
+    0x49, 0x8b, 0x10, 0x49, 0x8b, 0x48, 0x08, 0x45, 0x8b, 0x08, 0xf2, 0x41,
+    0x0f, 0x10, 0x40, 0x08, 0x75, 0x06, 0x41, 0x83, 0xf9, 0x02, 0x74, 0x3c,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd0,
+    0x83, 0xe0, 0x01, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0x89, 0xdf, 0x0f, 0x11,
+    0x45, 0x00, 0x88, 0x45, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xc7, 0x45, 0x00, 0x01, 0x00, 0x00, 0x00, 0x48, 0x83,
+    0xc4, 0x08, 0x5b, 0x5d, 0xff, 0xe0, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+    0x66, 0x0f, 0x2e, 0xc8, 0xba, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x9b, 0xc0,
+    0x0f, 0x45, 0xc2, 0xeb, 0xbf,
+};
+static const aupHole aup_stencilHoles38[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 13, AUP_HOLE_RA, NULL, 0 },
+    { 23, AUP_HOLE_KC, NULL, 0 },
+    { 86, AUP_HOLE_SYM, (const void *)&aup_isEqual, 0 },
+    { 115, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode39[] = {
+    0x49, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xbd, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x48, 0x01, 0xf8, 0x48,
+    0x01, 0xfd, 0x48, 0x89, 0xfb, 0x48, 0x83, 0xec, 0x08, 0x41, 0x83, 0x38,
+    0x02, 0x49, 0x8b, 0x38, 0x49, 0x8b, 0x70, 0x08, 0xf2, 0x41, 0x0f, 0x10,
+    0x48, 0x08, 0x48, 0x8b, 0x10, 0x48, 0x8b, 0x48, 0x08, 0x44, 0x8b, 0x08,
+    0xf2, 0x0f, 0x10, 0x40, 0x08, 0x75, 0x06, 0x41, 0x83, 0xf9, 0x02, 0x74,
+    0x3b, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xd0, 0x83, 0xe0, 0x01, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0x89, 0xdf, 0x0f,
+    0x11, 0x45, 0x00, 0x88, 0x45, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc7, 0x45, 0x00, 0x01, 0x00, 0x00, 0x00, 0x48,
+    0x83, 0xc4, 0x08, 0x5b, 0x5d, 0xff, 0xe0, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+    0x66, 0x0f, 0x2e, 0xc8, 0xba, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x9b, 0xc0,
+    0x0f, 0x45, 0xc2, 0xeb, 0xc0,
+};
+static const aupHole aup_stencilHoles39[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 13, AUP_HOLE_RC, NULL, 0 },
+    { 23, AUP_HOLE_RA, NULL, 0 },
+    { 87, AUP_HOLE_SYM, (const void *)&aup_isEqual, 0 },
+    { 116, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode40[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x48,
+    0x89, 0xfd, 0x49, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x53, 0x48, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x01, 0xfb, 0x48, 0x83, 0xec, 0x08, 0x83, 0x38, 0x02, 0x48, 0x8b, 0x38,
+    0x48, 0x8b, 0x70, 0x08, 0xf2, 0x0f, 0x10, 0x48, 0x08, 0x49, 0x8b, 0x10,
+    0x49, 0x8b, 0x48, 0x08, 0x45, 0x8b, 0x08, 0xf2, 0x41, 0x0f, 0x10, 0x40,
+    0x08, 0x75, 0x06, 0x41, 0x83, 0xf9, 0x02, 0x74, 0x37, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd0, 0x83, 0xe0, 0x01,
+    0x66, 0x0f, 0xef, 0xc0, 0x48, 0x89, 0xef, 0x0f, 0x11, 0x03, 0x88, 0x43,
+    0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7,
+    0x03, 0x01, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x08, 0x5b, 0x5d, 0xff,
+    0xe0, 0x0f, 0x1f, 0x00, 0x66, 0x0f, 0x2e, 0xc8, 0xba, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0x9b, 0xc0, 0x0f, 0x45, 0xc2, 0xeb, 0xc4,
+};
+static const aupHole aup_stencilHoles40[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 16, AUP_HOLE_KC, NULL, 0 },
+    { 27, AUP_HOLE_RA, NULL, 0 },
+    { 83, AUP_HOLE_SYM, (const void *)&aup_isEqual, 0 },
+    { 111, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode41[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01,
+    0xf8, 0x83, 0x38, 0x02, 0x74, 0x0e, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x00, 0x48, 0xba, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x10, 0x40, 0x08, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x0f, 0x57,
+    0x00, 0x48, 0x01, 0xfa, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xc7, 0x02, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x42,
+    0x08, 0xff, 0xe0,
+};
+static const uint8_t aup_stencilData41[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+};
+static const aupHole aup_stencilHoles41[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 20, AUP_HOLE_PC, NULL, 0 },
+    { 34, AUP_HOLE_RA, NULL, 0 },
+    { 49, AUP_HOLE_DATA, NULL, 0 },
+    { 66, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode42[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x38,
+    0x02, 0x74, 0x11, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xc3, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0xba, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x10, 0x40, 0x08, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x0f, 0x57,
+    0x00, 0x48, 0x01, 0xfa, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xc7, 0x02, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x42,
+    0x08, 0xff, 0xe0,
+};
+static const uint8_t aup_stencilData42[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+};
+static const aupHole aup_stencilHoles42[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 17, AUP_HOLE_PC, NULL, 0 },
+    { 34, AUP_HOLE_RA, NULL, 0 },
+    { 49, AUP_HOLE_DATA, NULL, 0 },
+    { 66, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode43[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x48,
+    0x01, 0xfa, 0x83, 0x38, 0x02, 0x75, 0x05, 0x83, 0x3a, 0x02, 0x74, 0x0c,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x90,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x40, 0x08, 0xf2, 0x0f, 0x58, 0x42, 0x08, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf9, 0xc7, 0x01, 0x02,
+    0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles43[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 38, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 70, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode44[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01,
+    0xf8, 0x83, 0x38, 0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x83, 0x3a, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x40, 0x08, 0xf2, 0x0f, 0x58, 0x42, 0x08, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf9, 0xc7, 0x01, 0x02,
+    0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles44[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 20, AUP_HOLE_KC, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 70, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode45[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x83,
+    0x3a, 0x02, 0x75, 0x05, 0x83, 0x38, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x42, 0x08, 0xf2, 0x0f, 0x58, 0x40, 0x08, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf9, 0xc7, 0x01, 0x02,
+    0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles45[] = {
+    { 2, AUP_HOLE_RC, NULL, 0 },
+    { 12, AUP_HOLE_KB, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 70, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode46[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x38,
+    0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x83, 0x3a, 0x02, 0x74, 0x12, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x42, 0x08, 0xf2, 0x0f, 0x58, 0x40, 0x08, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf9, 0xc7, 0x01, 0x02,
+    0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles46[] = {
+    { 2, AUP_HOLE_KC, NULL, 0 },
+    { 17, AUP_HOLE_KB, NULL, 0 },
+    { 32, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 70, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode47[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x48,
+    0x01, 0xfa, 0x83, 0x38, 0x02, 0x75, 0x05, 0x83, 0x3a, 0x02, 0x74, 0x0c,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x90,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x40, 0x08, 0xf2, 0x0f, 0x5c, 0x42, 0x08, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf9, 0xc7, 0x01, 0x02,
+    0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles47[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 38, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 70, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode48[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01,
+    0xf8, 0x83, 0x38, 0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x83, 0x3a, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x40, 0x08, 0xf2, 0x0f, 0x5c, 0x42, 0x08, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf9, 0xc7, 0x01, 0x02,
+    0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles48[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 20, AUP_HOLE_KC, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 70, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode49[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x83,
+    0x3a, 0x02, 0x75, 0x05, 0x83, 0x38, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x42, 0x08, 0xf2, 0x0f, 0x5c, 0x40, 0x08, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf9, 0xc7, 0x01, 0x02,
+    0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles49[] = {
+    { 2, AUP_HOLE_RC, NULL, 0 },
+    { 12, AUP_HOLE_KB, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 70, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode50[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x38,
+    0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x83, 0x3a, 0x02, 0x74, 0x12, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x42, 0x08, 0xf2, 0x0f, 0x5c, 0x40, 0x08, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf9, 0xc7, 0x01, 0x02,
+    0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles50[] = {
+    { 2, AUP_HOLE_KC, NULL, 0 },
+    { 17, AUP_HOLE_KB, NULL, 0 },
+    { 32, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 70, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode51[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x48,
+    0x01, 0xfa, 0x83, 0x38, 0x02, 0x75, 0x05, 0x83, 0x3a, 0x02, 0x74, 0x0c,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x90,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x40, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf2, 0x0f, 0x59, 0x42, 0x08, 0x48, 0x01, 0xf9, 0xc7, 0x01, 0x02,
+    0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles51[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 38, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 65, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode52[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01,
+    0xf8, 0x83, 0x38, 0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x83, 0x3a, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x40, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf2, 0x0f, 0x59, 0x42, 0x08, 0x48, 0x01, 0xf9, 0xc7, 0x01, 0x02,
+    0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles52[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 20, AUP_HOLE_KC, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 65, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode53[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x83,
+    0x3a, 0x02, 0x75, 0x05, 0x83, 0x38, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x42, 0x08, 0xf2, 0x0f, 0x59, 0x40, 0x08, 0x48, 0x01, 0xf9, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x01, 0x02,
+    0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles53[] = {
+    { 2, AUP_HOLE_RC, NULL, 0 },
+    { 12, AUP_HOLE_KB, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 73, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode54[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x38,
+    0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x83, 0x3a, 0x02, 0x74, 0x12, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x42, 0x08, 0xf2, 0x0f, 0x59, 0x40, 0x08, 0x48, 0x01, 0xf9, 0x48,
+    0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x01, 0x02,
+    0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles54[] = {
+    { 2, AUP_HOLE_KC, NULL, 0 },
+    { 17, AUP_HOLE_KB, NULL, 0 },
+    { 32, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 73, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode55[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x48,
+    0x01, 0xfa, 0x83, 0x38, 0x02, 0x75, 0x05, 0x83, 0x3a, 0x02, 0x74, 0x0c,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x90,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x40, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf2, 0x0f, 0x5e, 0x42, 0x08, 0x48, 0x01, 0xf9, 0xc7, 0x01, 0x02,
+    0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles55[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 38, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 65, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode56[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01,
+    0xf8, 0x83, 0x38, 0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x83, 0x3a, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x40, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf2, 0x0f, 0x5e, 0x42, 0x08, 0x48, 0x01, 0xf9, 0xc7, 0x01, 0x02,
+    0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles56[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 20, AUP_HOLE_KC, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 65, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode57[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x83,
+    0x3a, 0x02, 0x75, 0x05, 0x83, 0x38, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x42, 0x08, 0xf2, 0x0f, 0x5e, 0x40, 0x08, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf9, 0xc7, 0x01, 0x02,
+    0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles57[] = {
+    { 2, AUP_HOLE_RC, NULL, 0 },
+    { 12, AUP_HOLE_KB, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 70, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode58[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x38,
+    0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x83, 0x3a, 0x02, 0x74, 0x12, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f,
+    0x10, 0x42, 0x08, 0xf2, 0x0f, 0x5e, 0x40, 0x08, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf9, 0xc7, 0x01, 0x02,
+    0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles58[] = {
+    { 2, AUP_HOLE_KC, NULL, 0 },
+    { 17, AUP_HOLE_KB, NULL, 0 },
+    { 32, AUP_HOLE_PC, NULL, 0 },
+    { 50, AUP_HOLE_RA, NULL, 0 },
+    { 70, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode59[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x48,
+    0x01, 0xfa, 0x83, 0x38, 0x02, 0x75, 0x05, 0x83, 0x3a, 0x02, 0x74, 0x0c,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x90,
+    0x55, 0x48, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x01, 0xfd, 0x48, 0x83, 0xec, 0x10, 0xf2, 0x0f, 0x10, 0x40, 0x08, 0xf2,
+    0x0f, 0x10, 0x4a, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x7c, 0x24, 0x08, 0xff, 0xd0, 0xc7, 0x45, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x45, 0x08,
+    0x48, 0x83, 0xc4, 0x10, 0x5d, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles59[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 38, AUP_HOLE_PC, NULL, 0 },
+    { 51, AUP_HOLE_RA, NULL, 0 },
+    { 78, AUP_HOLE_SYM, (const void *)&fmod, 0 },
+    { 107, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode60[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01,
+    0xf8, 0x83, 0x38, 0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x83, 0x3a, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0x55, 0x48, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x01, 0xfd, 0x48, 0x83, 0xec, 0x10, 0xf2, 0x0f, 0x10, 0x40, 0x08, 0xf2,
+    0x0f, 0x10, 0x4a, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x7c, 0x24, 0x08, 0xff, 0xd0, 0xc7, 0x45, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x45, 0x08,
+    0x48, 0x83, 0xc4, 0x10, 0x5d, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles60[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 20, AUP_HOLE_KC, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 51, AUP_HOLE_RA, NULL, 0 },
+    { 78, AUP_HOLE_SYM, (const void *)&fmod, 0 },
+    { 107, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode61[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x83,
+    0x3a, 0x02, 0x75, 0x05, 0x83, 0x38, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0x55, 0x48, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x01, 0xfd, 0x48, 0x83, 0xec, 0x10, 0xf2, 0x0f, 0x10, 0x48, 0x08, 0xf2,
+    0x0f, 0x10, 0x42, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x7c, 0x24, 0x08, 0xff, 0xd0, 0xc7, 0x45, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x45, 0x08,
+    0x48, 0x83, 0xc4, 0x10, 0x5d, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles61[] = {
+    { 2, AUP_HOLE_RC, NULL, 0 },
+    { 12, AUP_HOLE_KB, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 51, AUP_HOLE_RA, NULL, 0 },
+    { 78, AUP_HOLE_SYM, (const void *)&fmod, 0 },
+    { 107, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode62[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x38,
+    0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x83, 0x3a, 0x02, 0x74, 0x12, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x53, 0x48, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x01, 0xfb, 0x48, 0x83, 0xec, 0x10, 0xf2, 0x0f, 0x10, 0x48, 0x08, 0xf2,
+    0x0f, 0x10, 0x42, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x7c, 0x24, 0x08, 0xff, 0xd0, 0xc7, 0x03, 0x02,
+    0x00, 0x00, 0x00, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x43, 0x08, 0x48,
+    0x83, 0xc4, 0x10, 0x5b, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles62[] = {
+    { 2, AUP_HOLE_KC, NULL, 0 },
+    { 17, AUP_HOLE_KB, NULL, 0 },
+    { 32, AUP_HOLE_PC, NULL, 0 },
+    { 51, AUP_HOLE_RA, NULL, 0 },
+    { 78, AUP_HOLE_SYM, (const void *)&fmod, 0 },
+    { 106, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode63[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x48,
+    0x01, 0xfa, 0x83, 0x38, 0x02, 0x75, 0x05, 0x83, 0x3a, 0x02, 0x74, 0x0c,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x90,
+    0x55, 0x48, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x01, 0xfd, 0x48, 0x83, 0xec, 0x10, 0xf2, 0x0f, 0x10, 0x40, 0x08, 0xf2,
+    0x0f, 0x10, 0x4a, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x7c, 0x24, 0x08, 0xff, 0xd0, 0xc7, 0x45, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x45, 0x08,
+    0x48, 0x83, 0xc4, 0x10, 0x5d, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles63[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 38, AUP_HOLE_PC, NULL, 0 },
+    { 51, AUP_HOLE_RA, NULL, 0 },
+    { 78, AUP_HOLE_SYM, (const void *)&pow, 0 },
+    { 107, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode64[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01,
+    0xf8, 0x83, 0x38, 0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x83, 0x3a, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0x55, 0x48, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x01, 0xfd, 0x48, 0x83, 0xec, 0x10, 0xf2, 0x0f, 0x10, 0x40, 0x08, 0xf2,
+    0x0f, 0x10, 0x4a, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x7c, 0x24, 0x08, 0xff, 0xd0, 0xc7, 0x45, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x45, 0x08,
+    0x48, 0x83, 0xc4, 0x10, 0x5d, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles64[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 20, AUP_HOLE_KC, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 51, AUP_HOLE_RA, NULL, 0 },
+    { 78, AUP_HOLE_SYM, (const void *)&pow, 0 },
+    { 107, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode65[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x83,
+    0x3a, 0x02, 0x75, 0x05, 0x83, 0x38, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0x55, 0x48, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x01, 0xfd, 0x48, 0x83, 0xec, 0x10, 0xf2, 0x0f, 0x10, 0x48, 0x08, 0xf2,
+    0x0f, 0x10, 0x42, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x7c, 0x24, 0x08, 0xff, 0xd0, 0xc7, 0x45, 0x00,
+    0x02, 0x00, 0x00, 0x00, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x45, 0x08,
+    0x48, 0x83, 0xc4, 0x10, 0x5d, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles65[] = {
+    { 2, AUP_HOLE_RC, NULL, 0 },
+    { 12, AUP_HOLE_KB, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 51, AUP_HOLE_RA, NULL, 0 },
+    { 78, AUP_HOLE_SYM, (const void *)&pow, 0 },
+    { 107, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode66[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x38,
+    0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x83, 0x3a, 0x02, 0x74, 0x12, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x53, 0x48, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x01, 0xfb, 0x48, 0x83, 0xec, 0x10, 0xf2, 0x0f, 0x10, 0x48, 0x08, 0xf2,
+    0x0f, 0x10, 0x42, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0x89, 0x7c, 0x24, 0x08, 0xff, 0xd0, 0xc7, 0x03, 0x02,
+    0x00, 0x00, 0x00, 0x48, 0x8b, 0x7c, 0x24, 0x08, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x43, 0x08, 0x48,
+    0x83, 0xc4, 0x10, 0x5b, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles66[] = {
+    { 2, AUP_HOLE_KC, NULL, 0 },
+    { 17, AUP_HOLE_KB, NULL, 0 },
+    { 32, AUP_HOLE_PC, NULL, 0 },
+    { 51, AUP_HOLE_RA, NULL, 0 },
+    { 78, AUP_HOLE_SYM, (const void *)&pow, 0 },
+    { 106, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode67[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01,
+    0xf8, 0x83, 0x38, 0x02, 0x74, 0x0e, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x00, 0xf2, 0x48, 0x0f, 0x2c,
+    0x40, 0x08, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xfa, 0xc7, 0x02, 0x02, 0x00, 0x00,
+    0x00, 0x48, 0xf7, 0xd0, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x42, 0x08,
+    0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles67[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 20, AUP_HOLE_PC, NULL, 0 },
+    { 44, AUP_HOLE_RA, NULL, 0 },
+    { 71, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode68[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x38,
+    0x02, 0x74, 0x11, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xc3, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2c,
+    0x40, 0x08, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xfa, 0xc7, 0x02, 0x02, 0x00, 0x00,
+    0x00, 0x48, 0xf7, 0xd0, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x42, 0x08,
+    0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles68[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 17, AUP_HOLE_PC, NULL, 0 },
+    { 44, AUP_HOLE_RA, NULL, 0 },
+    { 71, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode69[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x48,
+    0x01, 0xfa, 0x83, 0x38, 0x02, 0x75, 0x05, 0x83, 0x3a, 0x02, 0x74, 0x0c,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x90,
+    0xf2, 0x48, 0x0f, 0x2c, 0x40, 0x08, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0xb9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2c,
+    0x52, 0x08, 0x48, 0x01, 0xf9, 0xc7, 0x01, 0x02, 0x00, 0x00, 0x00, 0x48,
+    0x21, 0xd0, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles69[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 38, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_RA, NULL, 0 },
+    { 93, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode70[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01,
+    0xf8, 0x83, 0x38, 0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x83, 0x3a, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0xf2, 0x48, 0x0f, 0x2c, 0x40, 0x08, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0xb9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2c,
+    0x52, 0x08, 0x48, 0x01, 0xf9, 0xc7, 0x01, 0x02, 0x00, 0x00, 0x00, 0x48,
+    0x21, 0xd0, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles70[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 20, AUP_HOLE_KC, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_RA, NULL, 0 },
+    { 93, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode71[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x83,
+    0x3a, 0x02, 0x75, 0x05, 0x83, 0x38, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0xf2, 0x48, 0x0f, 0x2c, 0x52, 0x08, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0xb9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2c,
+    0x40, 0x08, 0x48, 0x01, 0xf9, 0xc7, 0x01, 0x02, 0x00, 0x00, 0x00, 0x48,
+    0x21, 0xd0, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles71[] = {
+    { 2, AUP_HOLE_RC, NULL, 0 },
+    { 12, AUP_HOLE_KB, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_RA, NULL, 0 },
+    { 93, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode72[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x38,
+    0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x83, 0x3a, 0x02, 0x74, 0x12, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0xf2, 0x48, 0x0f, 0x2c, 0x52, 0x08, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0xb9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2c,
+    0x40, 0x08, 0x48, 0x01, 0xf9, 0xc7, 0x01, 0x02, 0x00, 0x00, 0x00, 0x48,
+    0x21, 0xd0, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles72[] = {
+    { 2, AUP_HOLE_KC, NULL, 0 },
+    { 17, AUP_HOLE_KB, NULL, 0 },
+    { 32, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_RA, NULL, 0 },
+    { 93, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode73[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x48,
+    0x01, 0xfa, 0x83, 0x38, 0x02, 0x75, 0x05, 0x83, 0x3a, 0x02, 0x74, 0x0c,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x90,
+    0xf2, 0x48, 0x0f, 0x2c, 0x40, 0x08, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0xb9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2c,
+    0x52, 0x08, 0x48, 0x01, 0xf9, 0xc7, 0x01, 0x02, 0x00, 0x00, 0x00, 0x48,
+    0x09, 0xd0, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles73[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 38, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_RA, NULL, 0 },
+    { 93, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode74[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01,
+    0xf8, 0x83, 0x38, 0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x83, 0x3a, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0xf2, 0x48, 0x0f, 0x2c, 0x40, 0x08, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0xb9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2c,
+    0x52, 0x08, 0x48, 0x01, 0xf9, 0xc7, 0x01, 0x02, 0x00, 0x00, 0x00, 0x48,
+    0x09, 0xd0, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles74[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 20, AUP_HOLE_KC, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_RA, NULL, 0 },
+    { 93, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode75[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x83,
+    0x3a, 0x02, 0x75, 0x05, 0x83, 0x38, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0xf2, 0x48, 0x0f, 0x2c, 0x52, 0x08, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0xb9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2c,
+    0x40, 0x08, 0x48, 0x01, 0xf9, 0xc7, 0x01, 0x02, 0x00, 0x00, 0x00, 0x48,
+    0x09, 0xd0, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles75[] = {
+    { 2, AUP_HOLE_RC, NULL, 0 },
+    { 12, AUP_HOLE_KB, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_RA, NULL, 0 },
+    { 93, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode76[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x38,
+    0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x83, 0x3a, 0x02, 0x74, 0x12, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0xf2, 0x48, 0x0f, 0x2c, 0x52, 0x08, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0xb9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2c,
+    0x40, 0x08, 0x48, 0x01, 0xf9, 0xc7, 0x01, 0x02, 0x00, 0x00, 0x00, 0x48,
+    0x09, 0xd0, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles76[] = {
+    { 2, AUP_HOLE_KC, NULL, 0 },
+    { 17, AUP_HOLE_KB, NULL, 0 },
+    { 32, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_RA, NULL, 0 },
+    { 93, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode77[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x48,
+    0x01, 0xfa, 0x83, 0x38, 0x02, 0x75, 0x05, 0x83, 0x3a, 0x02, 0x74, 0x0c,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x90,
+    0xf2, 0x48, 0x0f, 0x2c, 0x40, 0x08, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0xb9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2c,
+    0x52, 0x08, 0x48, 0x01, 0xf9, 0xc7, 0x01, 0x02, 0x00, 0x00, 0x00, 0x48,
+    0x31, 0xd0, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles77[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 38, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_RA, NULL, 0 },
+    { 93, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode78[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01,
+    0xf8, 0x83, 0x38, 0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x83, 0x3a, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0xf2, 0x48, 0x0f, 0x2c, 0x40, 0x08, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0xb9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2c,
+    0x52, 0x08, 0x48, 0x01, 0xf9, 0xc7, 0x01, 0x02, 0x00, 0x00, 0x00, 0x48,
+    0x31, 0xd0, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles78[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 20, AUP_HOLE_KC, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_RA, NULL, 0 },
+    { 93, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode79[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x83,
+    0x3a, 0x02, 0x75, 0x05, 0x83, 0x38, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0xf2, 0x48, 0x0f, 0x2c, 0x52, 0x08, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0xb9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2c,
+    0x40, 0x08, 0x48, 0x01, 0xf9, 0xc7, 0x01, 0x02, 0x00, 0x00, 0x00, 0x48,
+    0x31, 0xd0, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles79[] = {
+    { 2, AUP_HOLE_RC, NULL, 0 },
+    { 12, AUP_HOLE_KB, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_RA, NULL, 0 },
+    { 93, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode80[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x38,
+    0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x83, 0x3a, 0x02, 0x74, 0x12, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0xf2, 0x48, 0x0f, 0x2c, 0x52, 0x08, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0xb9,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2c,
+    0x40, 0x08, 0x48, 0x01, 0xf9, 0xc7, 0x01, 0x02, 0x00, 0x00, 0x00, 0x48,
+    0x31, 0xd0, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x41, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles80[] = {
+    { 2, AUP_HOLE_KC, NULL, 0 },
+    { 17, AUP_HOLE_KB, NULL, 0 },
+    { 32, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_RA, NULL, 0 },
+    { 93, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode81[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x48,
+    0x01, 0xfa, 0x83, 0x38, 0x02, 0x75, 0x05, 0x83, 0x3a, 0x02, 0x74, 0x0c,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x90,
+    0xf2, 0x48, 0x0f, 0x2c, 0x40, 0x08, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0xbe,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2c,
+    0x4a, 0x08, 0x48, 0x01, 0xfe, 0xc7, 0x06, 0x02, 0x00, 0x00, 0x00, 0x48,
+    0xd3, 0xe0, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x46, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles81[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 38, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_RA, NULL, 0 },
+    { 93, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode82[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01,
+    0xf8, 0x83, 0x38, 0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x83, 0x3a, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0xf2, 0x48, 0x0f, 0x2c, 0x40, 0x08, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0xbe,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2c,
+    0x4a, 0x08, 0x48, 0x01, 0xfe, 0xc7, 0x06, 0x02, 0x00, 0x00, 0x00, 0x48,
+    0xd3, 0xe0, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x46, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles82[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 20, AUP_HOLE_KC, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_RA, NULL, 0 },
+    { 93, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode83[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x83,
+    0x3a, 0x02, 0x75, 0x05, 0x83, 0x38, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0xf2, 0x48, 0x0f, 0x2c, 0x48, 0x08, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0xbe,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2c, 0x52, 0x08,
+    0x48, 0x01, 0xfe, 0xc7, 0x06, 0x02, 0x00, 0x00, 0x00, 0x48, 0xd3, 0xe2,
+    0xf2, 0x48, 0x0f, 0x2a, 0xc2, 0xf2, 0x0f, 0x11, 0x46, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles83[] = {
+    { 2, AUP_HOLE_RC, NULL, 0 },
+    { 12, AUP_HOLE_KB, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_RA, NULL, 0 },
+    { 70, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode84[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x38,
+    0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x83, 0x3a, 0x02, 0x74, 0x12, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0xf2, 0x48, 0x0f, 0x2c, 0x48, 0x08, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0xbe,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2c, 0x52, 0x08,
+    0x48, 0x01, 0xfe, 0xc7, 0x06, 0x02, 0x00, 0x00, 0x00, 0x48, 0xd3, 0xe2,
+    0xf2, 0x48, 0x0f, 0x2a, 0xc2, 0xf2, 0x0f, 0x11, 0x46, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles84[] = {
+    { 2, AUP_HOLE_KC, NULL, 0 },
+    { 17, AUP_HOLE_KB, NULL, 0 },
+    { 32, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_RA, NULL, 0 },
+    { 70, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode85[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x48,
+    0x01, 0xfa, 0x83, 0x38, 0x02, 0x75, 0x05, 0x83, 0x3a, 0x02, 0x74, 0x0c,
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x90,
+    0xf2, 0x48, 0x0f, 0x2c, 0x40, 0x08, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0xbe,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2c,
+    0x4a, 0x08, 0x48, 0x01, 0xfe, 0xc7, 0x06, 0x02, 0x00, 0x00, 0x00, 0x48,
+    0xd3, 0xf8, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x46, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles85[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 12, AUP_HOLE_RC, NULL, 0 },
+    { 38, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_RA, NULL, 0 },
+    { 93, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode86[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01,
+    0xf8, 0x83, 0x38, 0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x83, 0x3a, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0xf2, 0x48, 0x0f, 0x2c, 0x40, 0x08, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0xbe,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2c,
+    0x4a, 0x08, 0x48, 0x01, 0xfe, 0xc7, 0x06, 0x02, 0x00, 0x00, 0x00, 0x48,
+    0xd3, 0xf8, 0xf2, 0x48, 0x0f, 0x2a, 0xc0, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x0f, 0x11, 0x46, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles86[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 20, AUP_HOLE_KC, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_RA, NULL, 0 },
+    { 93, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode87[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xf8, 0x83,
+    0x3a, 0x02, 0x75, 0x05, 0x83, 0x38, 0x02, 0x74, 0x0f, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x40, 0x00,
+    0xf2, 0x48, 0x0f, 0x2c, 0x48, 0x08, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0xbe,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2c, 0x52, 0x08,
+    0x48, 0x01, 0xfe, 0xc7, 0x06, 0x02, 0x00, 0x00, 0x00, 0x48, 0xd3, 0xfa,
+    0xf2, 0x48, 0x0f, 0x2a, 0xc2, 0xf2, 0x0f, 0x11, 0x46, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles87[] = {
+    { 2, AUP_HOLE_RC, NULL, 0 },
+    { 12, AUP_HOLE_KB, NULL, 0 },
+    { 35, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_RA, NULL, 0 },
+    { 70, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode88[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x38,
+    0x02, 0x75, 0x0f, 0x48, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x83, 0x3a, 0x02, 0x74, 0x12, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0xf2, 0x48, 0x0f, 0x2c, 0x48, 0x08, 0x66, 0x0f, 0xef, 0xc0, 0x48, 0xbe,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x48, 0x0f, 0x2c, 0x52, 0x08,
+    0x48, 0x01, 0xfe, 0xc7, 0x06, 0x02, 0x00, 0x00, 0x00, 0x48, 0xd3, 0xfa,
+    0xf2, 0x48, 0x0f, 0x2a, 0xc2, 0xf2, 0x0f, 0x11, 0x46, 0x08, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles88[] = {
+    { 2, AUP_HOLE_KC, NULL, 0 },
+    { 17, AUP_HOLE_KB, NULL, 0 },
+    { 32, AUP_HOLE_PC, NULL, 0 },
+    { 60, AUP_HOLE_RA, NULL, 0 },
+    { 70, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode89[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x0f,
+    0x6f, 0x04, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0x11, 0x04, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles89[] = {
+    { 2, AUP_HOLE_RB, NULL, 0 },
+    { 17, AUP_HOLE_RA, NULL, 0 },
+    { 31, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode90[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x0f,
+    0x6f, 0x00, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0f, 0x11, 0x04, 0x07, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles90[] = {
+    { 2, AUP_HOLE_KB, NULL, 0 },
+    { 16, AUP_HOLE_RA, NULL, 0 },
+    { 30, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode91[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x48,
+    0x89, 0xfb, 0x48, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xd0, 0x48, 0x89, 0xdf, 0x89, 0xc1, 0x48, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x01, 0xd8, 0x89, 0x08, 0x48, 0x89,
+    0x50, 0x08, 0x5b, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles91[] = {
+    { 2, AUP_HOLE_SYM, (const void *)&aup_loadGlobal, 0 },
+    { 16, AUP_HOLE_GLOBAL, NULL, 0 },
+    { 33, AUP_HOLE_RA, NULL, 0 },
+    { 53, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode92[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x48,
+    0x89, 0xfb, 0x48, 0x01, 0xf8, 0x48, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x8b, 0x30, 0x48, 0x8b, 0x50, 0x08, 0x48, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xd0, 0x48, 0x89, 0xdf,
+    0x5b, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xe0,
+};
+static const aupHole aup_stencilHoles92[] = {
+    { 2, AUP_HOLE_RC, NULL, 0 },
+    { 19, AUP_HOLE_GLOBAL, NULL, 0 },
+    { 35, AUP_HOLE_SYM, (const void *)&aup_storeGlobal, 0 },
+    { 51, AUP_HOLE_NEXT, NULL, 0 },
+};
+static const uint8_t aup_stencilCode93[] = {
+    0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x48,
+    0x89, 0xfb, 0x48, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x8b, 0x30, 0x48, 0x8b, 0x50, 0x08, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xd0, 0x48, 0x89, 0xdf, 0x5b, 0x48, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+};
+static const aupHole aup_stencilHoles93[] = {
+    { 2, AUP_HOLE_KC, NULL, 0 },
+    { 16, AUP_HOLE_GLOBAL, NULL, 0 },
+    { 32, AUP_HOLE_SYM, (const void *)&aup_storeGlobal, 0 },
+    { 48, AUP_HOLE_NEXT, NULL, 0 },
+};
+
+static const aupStencil aup_stencils[AUP_STENCIL_COUNT][4] = {
+    [AUP_STENCIL_EXIT] = {
+        { aup_stencilCode0, 11, 0, NULL, 0, aup_stencilHoles0, 1 },
+        { aup_stencilCode0, 11, 0, NULL, 0, aup_stencilHoles0, 1 },
+        { aup_stencilCode0, 11, 0, NULL, 0, aup_stencilHoles0, 1 },
+        { aup_stencilCode0, 11, 0, NULL, 0, aup_stencilHoles0, 1 },
+    },
+    [AUP_STENCIL_NOP] = {
+        { aup_stencilCode1, 12, 2, NULL, 0, aup_stencilHoles1, 1 },
+        { aup_stencilCode1, 12, 2, NULL, 0, aup_stencilHoles1, 1 },
+        { aup_stencilCode1, 12, 2, NULL, 0, aup_stencilHoles1, 1 },
+        { aup_stencilCode1, 12, 2, NULL, 0, aup_stencilHoles1, 1 },
+    },
+    [AUP_STENCIL_NIL] = {
+        { aup_stencilCode2, 30, 2, NULL, 0, aup_stencilHoles2, 2 },
+        { aup_stencilCode2, 30, 2, NULL, 0, aup_stencilHoles2, 2 },
+        { aup_stencilCode2, 30, 2, NULL, 0, aup_stencilHoles2, 2 },
+        { aup_stencilCode2, 30, 2, NULL, 0, aup_stencilHoles2, 2 },
+    },
+    [AUP_STENCIL_BOOL] = {
+        { aup_stencilCode3, 66, 2, NULL, 0, aup_stencilHoles3, 3 },
+        { aup_stencilCode3, 66, 2, NULL, 0, aup_stencilHoles3, 3 },
+        { aup_stencilCode3, 66, 2, NULL, 0, aup_stencilHoles3, 3 },
+        { aup_stencilCode3, 66, 2, NULL, 0, aup_stencilHoles3, 3 },
+    },
+    [AUP_STENCIL_JMPF] = {
+        { aup_stencilCode4, 44, 2, NULL, 0, aup_stencilHoles4, 3 },
+        { aup_stencilCode5, 44, 2, NULL, 0, aup_stencilHoles5, 3 },
+        { aup_stencilCode4, 44, 2, NULL, 0, aup_stencilHoles4, 3 },
+        { aup_stencilCode5, 44, 2, NULL, 0, aup_stencilHoles5, 3 },
+    },
+    [AUP_STENCIL_JNE] = {
+        { aup_stencilCode6, 199, 0, NULL, 0, aup_stencilHoles6, 6 },
+        { aup_stencilCode6, 199, 0, NULL, 0, aup_stencilHoles6, 6 },
+        { aup_stencilCode6, 199, 0, NULL, 0, aup_stencilHoles6, 6 },
+        { aup_stencilCode6, 199, 0, NULL, 0, aup_stencilHoles6, 6 },
+    },
+    [AUP_STENCIL_JLT] = {
+        { aup_stencilCode7, 114, 2, NULL, 0, aup_stencilHoles7, 6 },
+        { aup_stencilCode8, 114, 2, NULL, 0, aup_stencilHoles8, 6 },
+        { aup_stencilCode9, 114, 2, NULL, 0, aup_stencilHoles9, 6 },
+        { aup_stencilCode10, 114, 2, NULL, 0, aup_stencilHoles10, 6 },
+    },
+    [AUP_STENCIL_JLE] = {
+        { aup_stencilCode11, 114, 2, NULL, 0, aup_stencilHoles11, 6 },
+        { aup_stencilCode12, 114, 2, NULL, 0, aup_stencilHoles12, 6 },
+        { aup_stencilCode13, 114, 2, NULL, 0, aup_stencilHoles13, 6 },
+        { aup_stencilCode14, 114, 2, NULL, 0, aup_stencilHoles14, 6 },
+    },
+    [AUP_STENCIL_JEQ] = {
+        { aup_stencilCode15, 153, 0, NULL, 0, aup_stencilHoles15, 6 },
+        { aup_stencilCode16, 145, 0, NULL, 0, aup_stencilHoles16, 6 },
+        { aup_stencilCode17, 153, 0, NULL, 0, aup_stencilHoles17, 6 },
+        { aup_stencilCode18, 145, 0, NULL, 0, aup_stencilHoles18, 6 },
+    },
+    [AUP_STENCIL_NOT] = {
+        { aup_stencilCode19, 69, 2, NULL, 0, aup_stencilHoles19, 3 },
+        { aup_stencilCode19, 69, 2, NULL, 0, aup_stencilHoles19, 3 },
+        { aup_stencilCode20, 68, 2, NULL, 0, aup_stencilHoles20, 3 },
+        { aup_stencilCode20, 68, 2, NULL, 0, aup_stencilHoles20, 3 },
+    },
+    [AUP_STENCIL_LT] = {
+        { aup_stencilCode21, 111, 2, NULL, 0, aup_stencilHoles21, 5 },
+        { aup_stencilCode22, 111, 2, NULL, 0, aup_stencilHoles22, 5 },
+        { aup_stencilCode23, 111, 2, NULL, 0, aup_stencilHoles23, 5 },
+        { aup_stencilCode24, 111, 2, NULL, 0, aup_stencilHoles24, 5 },
+    },
+    [AUP_STENCIL_LE] = {
+        { aup_stencilCode25, 111, 2, NULL, 0, aup_stencilHoles25, 5 },
+        { aup_stencilCode26, 111, 2, NULL, 0, aup_stencilHoles26, 5 },
+        { aup_stencilCode27, 111, 2, NULL, 0, aup_stencilHoles27, 5 },
+        { aup_stencilCode28, 111, 2, NULL, 0, aup_stencilHoles28, 5 },
+    },
+    [AUP_STENCIL_GT] = {
+        { aup_stencilCode29, 111, 2, NULL, 0, aup_stencilHoles29, 5 },
+        { aup_stencilCode30, 111, 2, NULL, 0, aup_stencilHoles30, 5 },
+        { aup_stencilCode31, 111, 2, NULL, 0, aup_stencilHoles31, 5 },
+        { aup_stencilCode32, 111, 2, NULL, 0, aup_stencilHoles32, 5 },
+    },
+    [AUP_STENCIL_GE] = {
+        { aup_stencilCode33, 111, 2, NULL, 0, aup_stencilHoles33, 5 },
+        { aup_stencilCode34, 111, 2, NULL, 0, aup_stencilHoles34, 5 },
+        { aup_stencilCode35, 111, 2, NULL, 0, aup_stencilHoles35, 5 },
+        { aup_stencilCode36, 111, 2, NULL, 0, aup_stencilHoles36, 5 },
+    },
+    [AUP_STENCIL_EQ] = {
+        { aup_stencilCode37, 161, 0, NULL, 0, aup_stencilHoles37, 5 },
+        { aup_stencilCode38, 161, 0, NULL, 0, aup_stencilHoles38, 5 },
+        { aup_stencilCode39, 161, 0, NULL, 0, aup_stencilHoles39, 5 },
+        { aup_stencilCode40, 153, 0, NULL, 0, aup_stencilHoles40, 5 },
+    },
+    [AUP_STENCIL_NEG] = {
+        { aup_stencilCode41, 87, 2, aup_stencilData41, 16, aup_stencilHoles41, 5 },
+        { aup_stencilCode41, 87, 2, aup_stencilData41, 16, aup_stencilHoles41, 5 },
+        { aup_stencilCode42, 87, 2, aup_stencilData42, 16, aup_stencilHoles42, 5 },
+        { aup_stencilCode42, 87, 2, aup_stencilData42, 16, aup_stencilHoles42, 5 },
+    },
+    [AUP_STENCIL_ADD] = {
+        { aup_stencilCode43, 94, 2, NULL, 0, aup_stencilHoles43, 5 },
+        { aup_stencilCode44, 94, 2, NULL, 0, aup_stencilHoles44, 5 },
+        { aup_stencilCode45, 94, 2, NULL, 0, aup_stencilHoles45, 5 },
+        { aup_stencilCode46, 94, 2, NULL, 0, aup_stencilHoles46, 5 },
+    },
+    [AUP_STENCIL_SUB] = {
+        { aup_stencilCode47, 94, 2, NULL, 0, aup_stencilHoles47, 5 },
+        { aup_stencilCode48, 94, 2, NULL, 0, aup_stencilHoles48, 5 },
+        { aup_stencilCode49, 94, 2, NULL, 0, aup_stencilHoles49, 5 },
+        { aup_stencilCode50, 94, 2, NULL, 0, aup_stencilHoles50, 5 },
+    },
+    [AUP_STENCIL_MUL] = {
+        { aup_stencilCode51, 94, 2, NULL, 0, aup_stencilHoles51, 5 },
+        { aup_stencilCode52, 94, 2, NULL, 0, aup_stencilHoles52, 5 },
+        { aup_stencilCode53, 94, 2, NULL, 0, aup_stencilHoles53, 5 },
+        { aup_stencilCode54, 94, 2, NULL, 0, aup_stencilHoles54, 5 },
+    },
+    [AUP_STENCIL_DIV] = {
+        { aup_stencilCode55, 94, 2, NULL, 0, aup_stencilHoles55, 5 },
+        { aup_stencilCode56, 94, 2, NULL, 0, aup_stencilHoles56, 5 },
+        { aup_stencilCode57, 94, 2, NULL, 0, aup_stencilHoles57, 5 },
+        { aup_stencilCode58, 94, 2, NULL, 0, aup_stencilHoles58, 5 },
+    },
+    [AUP_STENCIL_MOD] = {
+        { aup_stencilCode59, 127, 2, NULL, 0, aup_stencilHoles59, 6 },
+        { aup_stencilCode60, 127, 2, NULL, 0, aup_stencilHoles60, 6 },
+        { aup_stencilCode61, 127, 2, NULL, 0, aup_stencilHoles61, 6 },
+        { aup_stencilCode62, 126, 2, NULL, 0, aup_stencilHoles62, 6 },
+    },
+    [AUP_STENCIL_POW] = {
+        { aup_stencilCode63, 127, 2, NULL, 0, aup_stencilHoles63, 6 },
+        { aup_stencilCode64, 127, 2, NULL, 0, aup_stencilHoles64, 6 },
+        { aup_stencilCode65, 127, 2, NULL, 0, aup_stencilHoles65, 6 },
+        { aup_stencilCode66, 126, 2, NULL, 0, aup_stencilHoles66, 6 },
+    },
+    [AUP_STENCIL_BNOT] = {
+        { aup_stencilCode67, 86, 2, NULL, 0, aup_stencilHoles67, 4 },
+        { aup_stencilCode67, 86, 2, NULL, 0, aup_stencilHoles67, 4 },
+        { aup_stencilCode68, 86, 2, NULL, 0, aup_stencilHoles68, 4 },
+        { aup_stencilCode68, 86, 2, NULL, 0, aup_stencilHoles68, 4 },
+    },
+    [AUP_STENCIL_BAND] = {
+        { aup_stencilCode69, 108, 2, NULL, 0, aup_stencilHoles69, 5 },
+        { aup_stencilCode70, 108, 2, NULL, 0, aup_stencilHoles70, 5 },
+        { aup_stencilCode71, 108, 2, NULL, 0, aup_stencilHoles71, 5 },
+        { aup_stencilCode72, 108, 2, NULL, 0, aup_stencilHoles72, 5 },
+    },
+    [AUP_STENCIL_BOR] = {
+        { aup_stencilCode73, 108, 2, NULL, 0, aup_stencilHoles73, 5 },
+        { aup_stencilCode74, 108, 2, NULL, 0, aup_stencilHoles74, 5 },
+        { aup_stencilCode75, 108, 2, NULL, 0, aup_stencilHoles75, 5 },
+        { aup_stencilCode76, 108, 2, NULL, 0, aup_stencilHoles76, 5 },
+    },
+    [AUP_STENCIL_BXOR] = {
+        { aup_stencilCode77, 108, 2, NULL, 0, aup_stencilHoles77, 5 },
+        { aup_stencilCode78, 108, 2, NULL, 0, aup_stencilHoles78, 5 },
+        { aup_stencilCode79, 108, 2, NULL, 0, aup_stencilHoles79, 5 },
+        { aup_stencilCode80, 108, 2, NULL, 0, aup_stencilHoles80, 5 },
+    },
+    [AUP_STENCIL_SHL] = {
+        { aup_stencilCode81, 108, 2, NULL, 0, aup_stencilHoles81, 5 },
+        { aup_stencilCode82, 108, 2, NULL, 0, aup_stencilHoles82, 5 },
+        { aup_stencilCode83, 108, 2, NULL, 0, aup_stencilHoles83, 5 },
+        { aup_stencilCode84, 108, 2, NULL, 0, aup_stencilHoles84, 5 },
+    },
+    [AUP_STENCIL_SHR] = {
+        { aup_stencilCode85, 108, 2, NULL, 0, aup_stencilHoles85, 5 },
+        { aup_stencilCode86, 108, 2, NULL, 0, aup_stencilHoles86, 5 },
+        { aup_stencilCode87, 108, 2, NULL, 0, aup_stencilHoles87, 5 },
+        { aup_stencilCode88, 108, 2, NULL, 0, aup_stencilHoles88, 5 },
+    },
+    [AUP_STENCIL_MOV] = {
+        { aup_stencilCode89, 41, 2, NULL, 0, aup_stencilHoles89, 3 },
+        { aup_stencilCode89, 41, 2, NULL, 0, aup_stencilHoles89, 3 },
+        { aup_stencilCode89, 41, 2, NULL, 0, aup_stencilHoles89, 3 },
+        { aup_stencilCode89, 41, 2, NULL, 0, aup_stencilHoles89, 3 },
+    },
+    [AUP_STENCIL_LD] = {
+        { aup_stencilCode89, 41, 2, NULL, 0, aup_stencilHoles89, 3 },
+        { aup_stencilCode89, 41, 2, NULL, 0, aup_stencilHoles89, 3 },
+        { aup_stencilCode90, 40, 2, NULL, 0, aup_stencilHoles90, 3 },
+        { aup_stencilCode90, 40, 2, NULL, 0, aup_stencilHoles90, 3 },
+    },
+    [AUP_STENCIL_GLD] = {
+        { aup_stencilCode91, 63, 2, NULL, 0, aup_stencilHoles91, 4 },
+        { aup_stencilCode91, 63, 2, NULL, 0, aup_stencilHoles91, 4 },
+        { aup_stencilCode91, 63, 2, NULL, 0, aup_stencilHoles91, 4 },
+        { aup_stencilCode91, 63, 2, NULL, 0, aup_stencilHoles91, 4 },
+    },
+    [AUP_STENCIL_GST] = {
+        { aup_stencilCode92, 61, 2, NULL, 0, aup_stencilHoles92, 4 },
+        { aup_stencilCode93, 58, 2, NULL, 0, aup_stencilHoles93, 4 },
+        { aup_stencilCode92, 61, 2, NULL, 0, aup_stencilHoles92, 4 },
+        { aup_stencilCode93, 58, 2, NULL, 0, aup_stencilHoles93, 4 },
+    },
+};
+
+#endif
+
+#endif
@@ -63,11 +63,10 @@ bool aup_getKey(aupTab *table, aupStr *key, aupVal *value)
 static void expandTable(aupTab *table, int capMask)
 {
     aupEnt *entries = malloc(sizeof(aupEnt) * (capMask + 1));
-    memset(entries, '\0', sizeof(aupEnt) * (capMask + 1));
-    /*for (int i = 0; i <= capMask; i++) {
+    for (int i = 0; i <= capMask; i++) {
         entries[i].key = NULL;
         entries[i].value = AUP_VNil;
-    }*/
+    }
 
     table->count = 0;
     for (int i = 0; i <= table->capMask; i++) {
@@ -129,7 +128,8 @@ void aup_copyTable(aupTab *from, aupTab *to)
     }
 }
 
-aupStr *aup_findString(aupTab *table, int length, uint32_t hash)
+aupStr *aup_findString(aupTab *table, const char *chars, int length,
+                       uint32_t hash)
 {
     if (table->count == 0) return NULL;
 
@@ -145,7 +145,8 @@ aupStr *aup_findString(aupTab *table, int length, uint32_t hash)
                 return NULL;
             }
         }
-        else if (key->length == length && key->hash == hash) {
+        else if (key->length == length && key->hash == hash &&
+                 memcmp(key->chars, chars, length) == 0) {
             // We found it.
             return key;
         }
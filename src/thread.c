@@ -0,0 +1,140 @@
+#include <stdlib.h>
+
+#include "thread.h"
+
+#ifdef AUP_WIN32
+
+typedef struct {
+    aupThreadFn fn;
+    void *arg;
+} Start;
+
+static DWORD WINAPI threadMain(LPVOID param)
+{
+    Start start = *(Start *)param;
+    free(param);
+    start.fn(start.arg);
+    return 0;
+}
+
+void aup_initMutex(aupMutex *mutex)     { InitializeCriticalSection(mutex); }
+void aup_freeMutex(aupMutex *mutex)     { DeleteCriticalSection(mutex); }
+void aup_lock(aupMutex *mutex)          { EnterCriticalSection(mutex); }
+void aup_unlock(aupMutex *mutex)        { LeaveCriticalSection(mutex); }
+
+void aup_initCond(aupCond *cond)        { InitializeConditionVariable(cond); }
+void aup_freeCond(aupCond *cond)        { (void)cond; }
+void aup_wait(aupCond *cond, aupMutex *mutex) { SleepConditionVariableCS(cond, mutex, INFINITE); }
+void aup_signal(aupCond *cond)          { WakeConditionVariable(cond); }
+void aup_broadcast(aupCond *cond)       { WakeAllConditionVariable(cond); }
+
+bool aup_startThread(aupThread *thread, aupThreadFn fn, void *arg)
+{
+    Start *start = malloc(sizeof(Start));
+    start->fn = fn;
+    start->arg = arg;
+
+    *thread = CreateThread(NULL, 0, threadMain, start, 0, NULL);
+    if (*thread == NULL) {
+        free(start);
+        return false;
+    }
+
+    return true;
+}
+
+void aup_joinThread(aupThread thread)
+{
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+}
+
+int aup_cpuCount()
+{
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int)info.dwNumberOfProcessors;
+}
+
+void aup_yieldThread()
+{
+    SwitchToThread();
+}
+
+uint64_t aup_nanoTime()
+{
+    LARGE_INTEGER count, freq;
+    QueryPerformanceCounter(&count);
+    QueryPerformanceFrequency(&freq);
+    return (uint64_t)(count.QuadPart / freq.QuadPart) * 1000000000 +
+        (uint64_t)(count.QuadPart % freq.QuadPart) * 1000000000 / freq.QuadPart;
+}
+
+#else
+
+#include <unistd.h>
+#include <sched.h>
+#include <time.h>
+
+typedef struct {
+    aupThreadFn fn;
+    void *arg;
+} Start;
+
+static void *threadMain(void *param)
+{
+    Start start = *(Start *)param;
+    free(param);
+    start.fn(start.arg);
+    return NULL;
+}
+
+void aup_initMutex(aupMutex *mutex)     { pthread_mutex_init(mutex, NULL); }
+void aup_freeMutex(aupMutex *mutex)     { pthread_mutex_destroy(mutex); }
+void aup_lock(aupMutex *mutex)          { pthread_mutex_lock(mutex); }
+void aup_unlock(aupMutex *mutex)        { pthread_mutex_unlock(mutex); }
+
+void aup_initCond(aupCond *cond)        { pthread_cond_init(cond, NULL); }
+void aup_freeCond(aupCond *cond)        { pthread_cond_destroy(cond); }
+void aup_wait(aupCond *cond, aupMutex *mutex) { pthread_cond_wait(cond, mutex); }
+void aup_signal(aupCond *cond)          { pthread_cond_signal(cond); }
+void aup_broadcast(aupCond *cond)       { pthread_cond_broadcast(cond); }
+
+bool aup_startThread(aupThread *thread, aupThreadFn fn, void *arg)
+{
+    Start *start = malloc(sizeof(Start));
+    start->fn = fn;
+    start->arg = arg;
+
+    if (pthread_create(thread, NULL, threadMain, start) != 0) {
+        free(start);
+        return false;
+    }
+
+    return true;
+}
+
+void aup_joinThread(aupThread thread)
+{
+    pthread_join(thread, NULL);
+}
+
+int aup_cpuCount()
+{
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (int)count : 1;
+}
+
+void aup_yieldThread()
+{
+    sched_yield();
+}
+
+uint64_t aup_nanoTime()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+#endif
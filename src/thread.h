@@ -0,0 +1,38 @@
+#ifndef _AUP_THREAD_H
+#define _AUP_THREAD_H
+#pragma once
+
+#include "aup.h"
+
+#ifdef AUP_WIN32
+#include <windows.h>
+typedef CRITICAL_SECTION    aupMutex;
+typedef CONDITION_VARIABLE  aupCond;
+typedef HANDLE              aupThread;
+#else
+#include <pthread.h>
+typedef pthread_mutex_t     aupMutex;
+typedef pthread_cond_t      aupCond;
+typedef pthread_t           aupThread;
+#endif
+
+typedef void (* aupThreadFn)(void *arg);
+
+void aup_initMutex(aupMutex *mutex);
+void aup_freeMutex(aupMutex *mutex);
+void aup_lock(aupMutex *mutex);
+void aup_unlock(aupMutex *mutex);
+
+void aup_initCond(aupCond *cond);
+void aup_freeCond(aupCond *cond);
+void aup_wait(aupCond *cond, aupMutex *mutex);
+void aup_signal(aupCond *cond);
+void aup_broadcast(aupCond *cond);
+
+bool aup_startThread(aupThread *thread, aupThreadFn fn, void *arg);
+void aup_joinThread(aupThread thread);
+void aup_yieldThread();
+int  aup_cpuCount();
+uint64_t aup_nanoTime();
+
+#endif
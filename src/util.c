@@ -1,31 +1,219 @@
-#include <stdarg.h>
+#ifdef _WIN32
+#define _CRT_RAND_S
+#endif
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #include "util.h"
 
-uint32_t aup_hashBytes(int count, ...)
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+// Secrets of the hash, derived from a seed picked once per
+// process so that colliding keys can't be prepared offline.
+static uint64_t m_secret[4] = {
+    0xa0761d6478bd642fULL, 0xe7037ed1a0b428dbULL,
+    0x8ebc6af09c88c6e3ULL, 0x589965cc75374cc3ULL
+};
+static bool m_seeded = false;
+
+// 64x64 -> 128 bit product, both halves folded together.
+static uint64_t mix(uint64_t a, uint64_t b)
 {
-    uint32_t hash = 2166136261U;
-    if (count <= 0) return hash;
-
-    va_list ap;
-    va_start(ap, count);
-    
-    for (int i = 0; i < count; i++) {
-        const uint8_t *bytes = va_arg(ap, void *);
-        int length = va_arg(ap, int);
-        for (int j = 0; j < length; j++) {
-            hash ^= bytes[j];
-            hash *= 16777619;
+#if defined(__SIZEOF_INT128__)
+    __uint128_t r = (__uint128_t)a * b;
+    return (uint64_t)r ^ (uint64_t)(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    uint64_t hi, lo = _umul128(a, b, &hi);
+    return lo ^ hi;
+#else
+    uint64_t ha = a >> 32, la = (uint32_t)a;
+    uint64_t hb = b >> 32, lb = (uint32_t)b;
+    uint64_t hh = ha * hb, hl = ha * lb, lh = la * hb, ll = la * lb;
+    uint64_t t = ll + (hl << 32);
+    uint64_t lo = t + (lh << 32);
+    uint64_t hi = hh + (hl >> 32) + (lh >> 32) + (t < ll) + (lo < t);
+    return lo ^ hi;
+#endif
+}
+
+static uint64_t read64(const uint8_t *p)
+{
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static uint64_t splitMix(uint64_t *state)
+{
+    uint64_t z = (*state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+static uint64_t randomSeed()
+{
+    uint64_t seed = 0;
+#ifdef AUP_WIN32
+    unsigned int lo, hi;
+    if (rand_s(&lo) == 0 && rand_s(&hi) == 0)
+        seed = ((uint64_t)hi << 32) | lo;
+#else
+    FILE *random = fopen("/dev/urandom", "rb");
+    if (random != NULL) {
+        if (fread(&seed, sizeof(seed), 1, random) != 1) seed = 0;
+        fclose(random);
+    }
+#endif
+    // No entropy source, addresses and the clock still differ
+    // from run to run.
+    if (seed == 0) {
+        seed = (uint64_t)(uintptr_t)&seed ^ (uint64_t)(uintptr_t)&m_secret
+            ^ (uint64_t)time(NULL) ^ ((uint64_t)clock() << 32);
+    }
+    return seed;
+}
+
+void aup_initHash()
+{
+    // Interned strings keep their hash, the seed can't change
+    // once anything has been hashed.
+    if (m_seeded) return;
+    m_seeded = true;
+
+    uint64_t state = randomSeed();
+    for (int i = 0; i < 4; i++) {
+        // Odd, so a secret never cancels a word to zero on its own.
+        m_secret[i] = splitMix(&state) | 1;
+    }
+}
+
+// 32 bytes per round in two independent lanes.
+static void hashBlock(uint64_t lanes[2], const uint8_t *p)
+{
+    lanes[0] = mix(read64(p) ^ m_secret[2], read64(p + 8) ^ lanes[0]);
+    lanes[1] = mix(read64(p + 16) ^ m_secret[3], read64(p + 24) ^ lanes[1]);
+}
+
+// [tail] holds the last (length % 32) bytes.
+static uint32_t hashTail(const uint64_t lanes[2], const uint8_t *tail,
+                         uint64_t length)
+{
+    int left = (int)(length & 31);
+    uint64_t h = (length < 32) ? lanes[0]
+        : mix(lanes[0] ^ m_secret[1], lanes[1] ^ m_secret[2]);
+
+    for (; left >= 16; left -= 16, tail += 16) {
+        h = mix(read64(tail) ^ m_secret[2], read64(tail + 8) ^ h);
+    }
+
+    uint64_t words[2] = { 0, 0 };
+    memcpy(words, tail, left);
+    h = mix(words[0] ^ m_secret[3] ^ length, words[1] ^ h);
+    h = mix(h ^ m_secret[0], length ^ m_secret[1]);
+    return (uint32_t)(h ^ (h >> 32));
+}
+
+void aup_hashStart(aupHasher *hasher)
+{
+    hasher->lanes[0] = m_secret[0];
+    hasher->lanes[1] = m_secret[1];
+    hasher->length = 0;
+}
+
+void aup_hashUpdate(aupHasher *hasher, const void *bytes, size_t length)
+{
+    const uint8_t *p = bytes;
+    int buffered = (int)(hasher->length & 31);
+    hasher->length += length;
+
+    if (buffered > 0) {
+        size_t fill = 32 - buffered;
+        if (length < fill) {
+            memcpy(hasher->buffer + buffered, p, length);
+            return;
         }
+        memcpy(hasher->buffer + buffered, p, fill);
+        hashBlock(hasher->lanes, hasher->buffer);
+        p += fill;
+        length -= fill;
     }
 
-    va_end(ap);
+    for (; length >= 32; length -= 32, p += 32) {
+        hashBlock(hasher->lanes, p);
+    }
+    memcpy(hasher->buffer, p, length);
+}
+
+uint32_t aup_hashFinish(aupHasher *hasher)
+{
+    return hashTail(hasher->lanes, hasher->buffer, hasher->length);
+}
+
+uint32_t aup_hashBytes(const void *bytes, size_t length)
+{
+    const uint8_t *p = bytes;
+    uint64_t lanes[2] = { m_secret[0], m_secret[1] };
+
+    size_t blocks = length & ~(size_t)31;
+    for (size_t i = 0; i < blocks; i += 32) {
+        hashBlock(lanes, p + i);
+    }
+    return hashTail(lanes, p + blocks, length);
+}
+
+#ifdef AUP_HASHBENCH
+#include "thread.h"
+
+// The byte at a time FNV-1a the hash above replaced.
+static uint32_t fnv1a(const void *bytes, size_t length)
+{
+    const uint8_t *p = bytes;
+    uint32_t hash = 2166136261U;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= p[i];
+        hash *= 16777619;
+    }
     return hash;
 }
 
+// Throughput of both hashes over keys of a few sizes. Build
+// with -DAUP_HASHBENCH to enable.
+void aup_benchHash()
+{
+    static const size_t sizes[] = { 8, 64, 4096 };
+    static uint8_t bytes[4096 + 64];
+    for (size_t i = 0; i < sizeof(bytes); i++) bytes[i] = (uint8_t)(i * 131);
+
+    fprintf(stderr, "=== hash ===\n");
+    for (int s = 0; s < 3; s++) {
+        size_t size = sizes[s];
+        size_t rounds = (256u << 20) / size;
+        uint32_t sink = 0;
+
+        uint64_t start = aup_nanoTime();
+        for (size_t i = 0; i < rounds; i++)
+            sink += fnv1a(bytes + (i & 63), size);
+        uint64_t fnvTime = aup_nanoTime() - start;
+
+        start = aup_nanoTime();
+        for (size_t i = 0; i < rounds; i++)
+            sink += aup_hashBytes(bytes + (i & 63), size);
+        uint64_t hashTime = aup_nanoTime() - start;
+
+        double mb = (double)rounds * size / (1 << 20);
+        fprintf(stderr, "%5zu B  fnv1a %8.0f MB/s  seeded %8.0f MB/s  %5.2fx (%x)\n",
+            size, mb * 1e9 / fnvTime, mb * 1e9 / hashTime,
+            (double)fnvTime / hashTime, sink);
+    }
+}
+#endif
+
 char *aup_readFile(const char *path, size_t *size)
 {
     FILE *file = NULL;
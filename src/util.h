@@ -25,13 +25,55 @@
 #define UINT16_COUNT    (UINT16_MAX + 1)
 #endif
 
+// Plain word-sized atomics, enough for flags and counters.
+#if defined(__GNUC__) || defined(__clang__)
+#define AUP_AtomicLoad(p)       __atomic_load_n(p, __ATOMIC_ACQUIRE)
+#define AUP_AtomicStore(p, v)   __atomic_store_n(p, v, __ATOMIC_RELEASE)
+#define AUP_RelaxedLoad(p)      __atomic_load_n(p, __ATOMIC_RELAXED)
+#define AUP_RelaxedStore(p, v)  __atomic_store_n(p, v, __ATOMIC_RELAXED)
+#define AUP_AtomicAdd(p, v)     __atomic_add_fetch(p, v, __ATOMIC_RELAXED)
+#define AUP_AtomicOr64(p, v)    __atomic_fetch_or(p, v, __ATOMIC_RELAXED)
+#define AUP_AtomicCAS(p, e, d)  __sync_bool_compare_and_swap(p, e, d)
+#elif defined(_MSC_VER)
+#include <intrin.h>
+// Volatile accesses have acquire/release semantics on MSVC.
+#define AUP_AtomicLoad(p)       (*(p))
+#define AUP_AtomicStore(p, v)   (*(p) = (v))
+#define AUP_RelaxedLoad(p)      (*(p))
+#define AUP_RelaxedStore(p, v)  (*(p) = (v))
+#ifdef AUP_X64
+#define AUP_AtomicAdd(p, v)     _InterlockedExchangeAdd64((volatile __int64 *)(p), (__int64)(v))
+#else
+#define AUP_AtomicAdd(p, v)     _InterlockedExchangeAdd((volatile long *)(p), (long)(v))
+#endif
+#define AUP_AtomicOr64(p, v)    _InterlockedOr64((volatile __int64 *)(p), (__int64)(v))
+#define AUP_AtomicCAS(p, e, d)  (_InterlockedCompareExchange((volatile long *)(p), \
+                                    (long)(d), (long)(e)) == (long)(e))
+#endif
+
 #define AUP_PAIR(l, r)  (uint8_t)(((char)(l)) | ((char)(r)) << 4)
 #define AUP_GROW(cap)   (((cap) < 8) ? 8 : ((cap) << 1))
 
-// N, bytes1, length1, ..., bytesN, lengthN
-uint32_t aup_hashBytes(int count, ...);
+// String hash, a word at a time and seeded once per process
+// by aup_initHash. Feeding the bytes piece by piece through a
+// hasher gives the same hash as aup_hashBytes over all of them.
+typedef struct {
+    uint64_t lanes[2];
+    uint64_t length;
+    uint8_t buffer[32];
+} aupHasher;
+
+void aup_initHash();
+void aup_hashStart(aupHasher *hasher);
+void aup_hashUpdate(aupHasher *hasher, const void *bytes, size_t length);
+uint32_t aup_hashFinish(aupHasher *hasher);
+uint32_t aup_hashBytes(const void *bytes, size_t length);
 char *aup_readFile(const char *path, size_t *size);
 
+#ifdef AUP_HASHBENCH
+void aup_benchHash();
+#endif
+
 typedef struct _aupVM aupVM;
 typedef struct _aupVal aupVal;
 
@@ -40,7 +82,8 @@ typedef aupVal (* aupCFn)(aupVM *vm, int argc, aupVal *args);
 enum {
     AUP_OK,
     AUP_COMPILE_ERROR,
-    AUP_RUNTIME_ERROR
+    AUP_RUNTIME_ERROR,
+    AUP_YIELD
 };
 
 #endif
@@ -7,7 +7,7 @@
 
 void aup_printValue(aupVal val)
 {
-    switch (val.type) {
+    switch (AUP_Typeof(val)) {
         case AUP_TNIL:
         default:
             printf("nil");
@@ -26,7 +26,7 @@ void aup_printValue(aupVal val)
 
 const char *aup_typeName(aupVal val)
 {
-    switch (val.type) {
+    switch (AUP_Typeof(val)) {
         case AUP_TNIL:
             return "nil";
         case AUP_TBOOL:
@@ -36,9 +36,13 @@ const char *aup_typeName(aupVal val)
         case AUP_TOBJ: {
             switch (AUP_OType(val)) {
                 case AUP_OSTR:
+                case AUP_OROP:
                     return "str";
                 case AUP_OFUN:
+                case AUP_ONAT:
                     return "fun";
+                case AUP_OTSK:
+                    return "task";
             }
         }
     }
@@ -48,16 +52,28 @@ const char *aup_typeName(aupVal val)
 
 bool aup_isEqual(aupVal a, aupVal b)
 {
-    if (a.type == b.type) {
-        switch (a.type) {
+    if (AUP_Typeof(a) == AUP_Typeof(b)) {
+        switch (AUP_Typeof(a)) {
             case AUP_TNIL:
                 return true;
             case AUP_TBOOL:
                 return AUP_AsBool(a) == AUP_AsBool(b);
             case AUP_TNUM:
                 return AUP_AsNum(a) == AUP_AsNum(b);
-            case AUP_TOBJ:
-                return AUP_AsObj(a) == AUP_AsObj(b);
+            case AUP_TOBJ: {
+                if (AUP_AsObj(a) == AUP_AsObj(b)) return true;
+
+                // Flat strings are interned, a rope is compared by
+                // its bytes.
+                if ((AUP_IsRope(a) || AUP_IsRope(b)) &&
+                    AUP_IsString(a) && AUP_IsString(b)) {
+                    int la, lb;
+                    const char *ca = AUP_StrBytes(a, &la);
+                    const char *cb = AUP_StrBytes(b, &lb);
+                    return la == lb && memcmp(ca, cb, la) == 0;
+                }
+                return false;
+            }
             default:
                 return false;
         }
@@ -10,6 +10,9 @@ typedef struct _aupFun aupFun;
 typedef struct _aupUpv aupUpv;
 typedef struct _aupKls aupKls;
 typedef struct _aupInc aupInc;
+typedef struct _aupNat aupNat;
+typedef struct _aupTsk aupTsk;
+typedef struct _aupRop aupRop;
 
 typedef enum {
     AUP_TNIL,
@@ -24,6 +27,9 @@ typedef enum {
     AUP_OUPV,
     AUP_OKLS,
     AUP_OINC,
+    AUP_ONAT,
+    AUP_OTSK,
+    AUP_OROP,
 } aupTObj;
 
 enum {
@@ -52,6 +58,60 @@ enum {
 #undef PAIR
 };
 
+#ifdef AUP_NAN_BOXING
+
+// NaN-boxed value, size always is 8 bytes.
+// Numbers are stored as-is, other types live in the payload of a quiet NaN:
+//   nil/bool: 0 1111111111111 11 ... tag (1 = nil, 2 = false, 3 = true)
+//   object:   1 1111111111111 11 ... 48-bit pointer
+struct _aupVal {
+    union {
+        double   Num;
+        uint64_t raw;
+    };
+};
+
+#define AUP_QNAN        ((uint64_t)0x7FFC000000000000)
+#define AUP_SIGN        ((uint64_t)0x8000000000000000)
+
+#define AUP_TAG_NIL     1
+#define AUP_TAG_FALSE   2
+#define AUP_TAG_TRUE    3
+
+#define AUP_VNil        ((aupVal){ .raw = AUP_QNAN | AUP_TAG_NIL })
+#define AUP_VTrue       ((aupVal){ .raw = AUP_QNAN | AUP_TAG_TRUE })
+#define AUP_VFalse      ((aupVal){ .raw = AUP_QNAN | AUP_TAG_FALSE })
+
+#define AUP_VBool(b)    ((b) ? AUP_VTrue : AUP_VFalse)
+#define AUP_VNum(n)     ((aupVal){ .Num = (double)(n) })
+#define AUP_VObj(o)     ((aupVal){ .raw = AUP_SIGN | AUP_QNAN | (uint64_t)(uintptr_t)(o) })
+
+#define AUP_AsBool(v)   ((v).raw == (AUP_QNAN | AUP_TAG_TRUE))
+#define AUP_AsNum(v)    ((v).Num)
+#define AUP_AsObj(v)    ((aupObj *)(uintptr_t)((v).raw & ~(AUP_SIGN | AUP_QNAN)))
+#define AUP_AsInt(v)    ((int)AUP_AsNum(v))
+#define AUP_AsI64(v)    ((int64_t)AUP_AsNum(v))
+#define AUP_AsRaw(v)    ((v).raw)
+
+#define AUP_IsNil(v)    ((v).raw == (AUP_QNAN | AUP_TAG_NIL))
+#define AUP_IsBool(v)   (((v).raw | 1) == (AUP_QNAN | AUP_TAG_TRUE))
+#define AUP_IsNum(v)    (((v).raw & AUP_QNAN) != AUP_QNAN)
+#define AUP_IsObj(v)    (((v).raw & (AUP_SIGN | AUP_QNAN)) == (AUP_SIGN | AUP_QNAN))
+
+static inline aupTVal AUP_Typeof(aupVal v) {
+    if (AUP_IsNum(v)) return AUP_TNUM;
+    if (AUP_IsObj(v)) return AUP_TOBJ;
+    return AUP_IsNil(v) ? AUP_TNIL : AUP_TBOOL;
+}
+
+static inline bool AUP_IsFalsey(aupVal v) {
+    if (AUP_IsNum(v)) return AUP_AsNum(v) == 0;
+    return v.raw == (AUP_QNAN | AUP_TAG_NIL)
+        || v.raw == (AUP_QNAN | AUP_TAG_FALSE);
+}
+
+#else
+
 struct _aupVal {
     aupTVal type;
     union {
@@ -98,6 +158,8 @@ static bool AUP_IsFalsey(aupVal v) {
 #define AUP_IsFalsey(v) (!(bool)AUP_AsRaw(v))
 #endif
 
+#endif
+
 void aup_printValue(aupVal val);
 const char *aup_typeName(aupVal val);
 bool aup_isEqual(aupVal a, aupVal b);
@@ -131,6 +193,7 @@ bool aup_getKey(aupTab *table, aupStr *key, aupVal *value);
 bool aup_setKey(aupTab *table, aupStr *key, aupVal value);
 bool aup_removeKey(aupTab *table, aupStr *key);
 void aup_copyTable(aupTab *from, aupTab *to);
-aupStr *aup_findString(aupTab *table, int length, uint32_t hash);
+aupStr *aup_findString(aupTab *table, const char *chars, int length,
+                       uint32_t hash);
 
 #endif
@@ -3,11 +3,14 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <time.h>
 
 #include "util.h"
 #include "code.h"
 #include "vm.h"
 #include "value.h"
+#include "sched.h"
+#include "jit.h"
 
 static void resetStack(aupVM *vm)
 {
@@ -15,35 +18,83 @@ static void resetStack(aupVM *vm)
     vm->frameCount = 0;
 }
 
-aupVM *aup_createVM(aupVM *from)
+static aupVal clockNative(aupVM *vm, int argc, aupVal *args)
+{
+    (void)vm, (void)argc, (void)args;
+    return AUP_VNum((double)clock() / CLOCKS_PER_SEC);
+}
+
+static aupVM *createVM(aupVM *from, size_t arenaLimit)
 {
     aupVM *vm = malloc(sizeof(aupVM));
     memset(vm, '\0', sizeof(aupVM));
 
-    if (from != NULL) {
-        vm->next = from->next;
-        from->next = vm;
-    }
-    else {
-        aup_initGC();
-        vm->next = vm;
+    vm->stackSpace = AUP_MIN_STACK;
+    vm->stack = malloc(sizeof(aupVal) * vm->stackSpace);
+    vm->frameSpace = AUP_MIN_FRAMES;
+    vm->frames = malloc(sizeof(aupFrame) * vm->frameSpace);
+
+    if (from == NULL) {
+        aup_initGC(arenaLimit);
     }
+    aup_attachVM(vm, from);
 
     resetStack(vm);
+
+    if (from == NULL) {
+        aup_defineNative(vm, "clock", clockNative);
+        aup_initSched(vm);
+        aup_initGCLib(vm);
+    }
+
     return vm;
 }
 
+aupVM *aup_createVM(aupVM *from)
+{
+    return createVM(from, 0);
+}
+
+// For short-lived scripts, objects are never collected and the
+// buffers they own are bump allocated. The heap is only freed
+// with the VM, unless it grows past [limit] bytes; from then on
+// it collects as usual.
+aupVM *aup_createArenaVM(size_t limit)
+{
+    return createVM(NULL, (limit > 0) ? limit : AUP_ARENA_LIMIT);
+}
+
 void aup_closeVM(aupVM *vm)
 {
     if (vm == NULL) return;
 
-    if (vm->next == vm) {
+    // Outstanding routines may still reference this heap.
+    if (vm->task == NULL) {
+        aup_stopSched();
+    }
+
+    if (aup_detachVM(vm)) {
         aup_freeGC();
     }
 
+    free(vm->stack);
+    free(vm->frames);
     free(vm);
 }
 
+void aup_defineNative(aupVM *vm, const char *name, aupCFn fn)
+{
+    aupStr *string = aup_copyString(name, -1);
+    AUP_PushRoot(vm, (aupObj *)string);
+
+    aupNat *native = aup_newNative(string, fn);
+    AUP_PushRoot(vm, (aupObj *)native);
+
+    aup_setGlobal(string, AUP_VObj(native));
+    AUP_PopRoot(vm);
+    AUP_PopRoot(vm);
+}
+
 static void runtimeError(aupVM *vm, const char *format, ...)
 {
     va_list args;
@@ -71,6 +122,32 @@ static void runtimeError(aupVM *vm, const char *format, ...)
     resetStack(vm);
 }
 
+// Move the register stack to a larger block, every pointer
+// into the old one is rebased: frames, top and open upvalues.
+static void growStack(aupVM *vm, int needed)
+{
+    int space = vm->stackSpace;
+    while (space < needed) space <<= 1;
+
+    aupVal *old = vm->stack;
+    aupVal *stack = malloc(sizeof(aupVal) * space);
+    memcpy(stack, old, sizeof(aupVal) * vm->stackSpace);
+
+    for (int i = 0; i < vm->frameCount; i++) {
+        vm->frames[i].stack = stack + (vm->frames[i].stack - old);
+    }
+    for (aupUpv *upval = vm->openUpvals;
+        upval != NULL;
+        upval = upval->next) {
+        upval->location = stack + (upval->location - old);
+    }
+    vm->top = stack + (vm->top - old);
+
+    free(old);
+    vm->stack = stack;
+    vm->stackSpace = space;
+}
+
 static bool call(aupVM *vm, aupFun *function, int argCount)
 {
     if (argCount != function->arity) {
@@ -78,16 +155,32 @@ static bool call(aupVM *vm, aupFun *function, int argCount)
             function->arity, argCount);
         return false;
     }
-    else if (vm->frameCount == AUP_MAX_FRAMES) {
+
+    int needed = (int)(vm->top - vm->stack) + function->regs + 1;
+    if (vm->frameCount == AUP_MAX_FRAMES || needed > AUP_MAX_STACK) {
         runtimeError(vm, "Stack overflow.");
         return false;
     }
 
+    if (vm->frameCount == vm->frameSpace) {
+        vm->frameSpace <<= 1;
+        vm->frames = realloc(vm->frames, sizeof(aupFrame) * vm->frameSpace);
+    }
+    if (needed > vm->stackSpace) {
+        growStack(vm, needed);
+    }
+
     aupFrame *frame = &vm->frames[vm->frameCount++];
     frame->function = function;
     frame->ip = function->chunk.code;
 
     frame->stack = vm->top;
+
+    // Clear what the arguments do not cover, no stale values
+    // from earlier frames show through.
+    for (int i = argCount + 1; i < function->regs; i++) {
+        frame->stack[i] = AUP_VNil;
+    }
     return true;
 }
 
@@ -98,6 +191,30 @@ static bool callValue(aupVM *vm, aupVal callee, int argCount)
             case AUP_OFUN:
                 return call(vm, AUP_AsFun(callee), argCount);
 
+            case AUP_ONAT: {
+                // Arguments are read in place from the caller's
+                // registers, the result goes to the callee slot.
+                // Meanwhile the caller's frame sits on the call, the
+                // stack map there keeps the arguments alive.
+                aupFrame *frame = (vm->frameCount > 0)
+                    ? &vm->frames[vm->frameCount - 1] : NULL;
+                if (frame != NULL) frame->ip--;
+
+                // Natives get ropes as flat strings.
+                aupVal *slot = vm->top;
+                for (int i = 1; i <= argCount; i++) {
+                    if (AUP_IsRope(slot[i])) {
+                        slot[i] = AUP_VObj(aup_flatten(slot[i]));
+                    }
+                }
+
+                aupVal result = AUP_AsNat(callee)->fn(vm, argCount, slot + 1);
+                if (!vm->blocked) *slot = result;
+
+                if (frame != NULL) frame->ip++;
+                return true;
+            }
+
             default:
                 // Non-callable object type.                   
                 break;
@@ -138,22 +255,74 @@ static void closeUpvals(aupVM *vm, aupVal *last)
     while (vm->openUpvals != NULL &&
            vm->openUpvals->location >= last) {
         aupUpv *upval = vm->openUpvals;
-        upval->closed = *upval->location;
+        AUP_SetValue(upval, &upval->closed, *upval->location);
         upval->location = &upval->closed;
         vm->openUpvals = upval->next;
     }
 }
 
+#ifdef AUP_OPSTATS
+// Dynamic opcode pair counters, used to pick candidates for
+// superinstructions. Build with -DAUP_OPSTATS to enable.
+static uint64_t m_opPairs[0x40][0x40];
+static aupOp m_lastOp;
+
+static aupOp countOp(aupOp op)
+{
+    m_opPairs[m_lastOp][op]++;
+    m_lastOp = op;
+    return op;
+}
+
+void aup_dumpOpStats(int top)
+{
+    uint64_t total = 0;
+    for (int i = 0; i < 0x40; i++)
+        for (int j = 0; j < 0x40; j++)
+            total += m_opPairs[i][j];
+    if (total == 0) return;
+
+    fprintf(stderr, "=== opcode pairs (%llu) ===\n", (unsigned long long)total);
+
+    // Selection by repeated max, the table is tiny.
+    uint64_t last = UINT64_MAX;
+    for (int n = 0; n < top; ) {
+        uint64_t max = 0;
+        for (int i = 0; i < 0x40; i++)
+            for (int j = 0; j < 0x40; j++)
+                if (m_opPairs[i][j] < last && m_opPairs[i][j] > max)
+                    max = m_opPairs[i][j];
+        if (max == 0) break;
+
+        for (int i = 0; i < 0x40 && n < top; i++)
+            for (int j = 0; j < 0x40 && n < top; j++)
+                if (m_opPairs[i][j] == max) {
+                    fprintf(stderr, "%-8s %-8s %12llu %6.2f%%\n",
+                        i < AUP_OPCOUNT ? aup_opName(i) : "?",
+                        j < AUP_OPCOUNT ? aup_opName(j) : "?",
+                        (unsigned long long)max, max * 100.0 / total);
+                    n++;
+                }
+        last = max;
+    }
+}
+#endif
+
 static int exec(aupVM *vm)
 {
     register uint32_t *ip;
     register aupFrame *frame;
-    register aupTab   *globals;
+    register aupArr   *globals;
     register aupVal   left, right;
 
 #define STORE_FRAME() \
 	frame->ip = ip
 
+// For the instructions that may stop for the collector, whose
+// stack map is keyed by the instruction itself.
+#define STORE_PC() \
+    frame->ip = ip - 1
+
 #define LOAD_FRAME() \
 	frame = &vm->frames[vm->frameCount - 1]; \
 	ip = frame->ip
@@ -162,12 +331,19 @@ static int exec(aupVM *vm)
     STORE_FRAME(), \
     runtimeError(vm, fmt, ##__VA_ARGS__)
 
-#define FETCH() AUP_GetOp(*ip++)
-#define READ()  (ip[-1])
+// Code is shared by every thread and rewritten in place by
+// quickening, instruction words are only accessed atomically.
+#ifdef AUP_OPSTATS
+#define FETCH() countOp(AUP_GetOp(AUP_RelaxedLoad(ip++)))
+#else
+#define FETCH() AUP_GetOp(AUP_RelaxedLoad(ip++))
+#endif
+#define READ()  AUP_RelaxedLoad(&ip[-1])
 
 #define R(i)    (frame->stack[i])
 #define K(i)    (frame->function->chunk.constants.values[i])
 #define U(i)    *(frame->function->upvals[i]->location)
+#define G(i)    (globals->values[(uint16_t)(i)])
 
 #define A       AUP_GetA(READ())
 #define B       AUP_GetB(READ())
@@ -178,8 +354,17 @@ static int exec(aupVM *vm)
 #define Bxx     AUP_GetBxx(READ())
 
 #define RA      R(AUP_GetA(READ()))
+#ifdef AUP_CHECKMAPS
+// Registers read as operands must be live by the stack maps.
+#define RB      (*aup_checkSlot(&R(AUP_GetB(READ()))))
+#define RC      (*aup_checkSlot(&R(AUP_GetC(READ()))))
+#define CHECK_REGS(from, count) \
+    for (int _i = 0; _i < (count); _i++) aup_checkSlot(&R((from) + _i))
+#else
 #define RB      R(AUP_GetB(READ()))
 #define RC      R(AUP_GetC(READ()))
+#define CHECK_REGS(from, count)
+#endif
 
 #define KA      K(AUP_GetA(READ()))
 #define KB      K(AUP_GetB(READ()))
@@ -191,6 +376,52 @@ static int exec(aupVM *vm)
 #define RKB     (sB ? KB : RB)
 #define RKC     (sC ? KC : RC)
 
+// Rewrite the current instruction in place, the next execution
+// of this site dispatches straight to the given variant.
+#define QUICKEN(x) \
+    AUP_RelaxedStore(&ip[-1], AUP_SetOp(READ(), AUP_OP_##x))
+
+// Compare-and-branch, the offset is held by the following JMP.
+#define BRANCH(cond) \
+    ip += ((cond) == A) ? AUP_GetAxx(AUP_RelaxedLoad(ip)) + 1 : 1
+
+// Guard failed, restore the generic opcode and re-execute it.
+#define DEQUICKEN(x) \
+    QUICKEN(x); \
+    ip--; \
+    NEXT
+
+// Park for a pending collection, then hand the thread back to
+// the scheduler if the time slice is used up.
+#define PREEMPT() \
+    if (AUP_AtomicLoad(&aup_stopRequest)) { \
+        STORE_FRAME(); \
+        aup_safepoint(); \
+    } \
+    if (--vm->budget <= 0) { \
+        STORE_FRAME(); \
+        return AUP_YIELD; \
+    }
+
+#ifdef AUP_JIT
+// Run the frame's machine code up to the next instruction it
+// leaves to the interpreter. Entered wherever a frame is loaded.
+#define JIT_ENTER() \
+    if (frame->function->jit != NULL) { \
+        ip = aup_jitRun(frame->function, frame->stack, ip); \
+    }
+#else
+#define JIT_ENTER()
+#endif
+
+// A native could not complete, the call runs again once
+// this VM is resumed.
+#define RETRY_BLOCKED() \
+    if (vm->blocked) { \
+        frame->ip = ip - 1; \
+        return AUP_YIELD; \
+    }
+
 #if defined(_MSC_VER)
 // Switched goto
 #define _CODE(x)        case AUP_OP_##x: goto _lbl_##x;
@@ -215,13 +446,15 @@ static int exec(aupVM *vm)
 #endif
 
     LOAD_FRAME();
-    globals = aup_getGlobals();
+    globals = aup_getGlobalValues();
+    JIT_ENTER();
 
     INTERPRET
     {
         CODE(PRI) // @ %R
         {
             int start = A, count = B;
+            CHECK_REGS(start, count);
             for (int i = 0; i < count; i++) {
                 aup_printValue(R(start + i));
                 if (i < count - 1) printf("\t");
@@ -253,6 +486,7 @@ static int exec(aupVM *vm)
         CODE(CLASS)
         {
             aupStr *name = AUP_AsStr(KB);
+            STORE_PC();
             RA = AUP_VObj(aup_newClass(name));
             NEXT;
         }
@@ -260,6 +494,7 @@ static int exec(aupVM *vm)
         CODE(CALL) // %R %argc
         {
             int argc = B;
+            CHECK_REGS(A, argc + 1);
 
             STORE_FRAME();
             //vm->top = &R_A();
@@ -267,26 +502,86 @@ static int exec(aupVM *vm)
             if (!callValue(vm, *(vm->top = &RA), argc)) {
                 return AUP_RUNTIME_ERROR;
             }
+            RETRY_BLOCKED();
+
+            LOAD_FRAME();
+            PREEMPT();
+            JIT_ENTER();
+            NEXT;
+        }
+        CODE(TAILCALL) // return %R(%argc)
+        {
+            int argc = B;
+            aupVal *callee = &RA;
+            CHECK_REGS(A, argc + 1);
+
+            if (AUP_IsNat(*callee)) {
+                // No frame to reuse, call in place and return.
+                STORE_FRAME();
+                callValue(vm, *(vm->top = callee), argc);
+                RETRY_BLOCKED();
+
+                R(0) = *callee;
+                if (--vm->frameCount == 0) {
+                    vm->top = vm->stack + 1;
+                    return AUP_OK;
+                }
+                LOAD_FRAME();
+                PREEMPT();
+                JIT_ENTER();
+                NEXT;
+            }
+
+            // A call that cannot succeed fails from this frame, it
+            // is still the one to report.
+            if (!AUP_IsFun(*callee) || AUP_AsFun(*callee)->arity != argc) {
+                STORE_FRAME();
+                callValue(vm, *(vm->top = callee), argc);
+                return AUP_RUNTIME_ERROR;
+            }
+
+            // Reuse the current frame, the callee and its arguments
+            // slide down to the frame base.
+            STORE_PC();
+            closeUpvals(vm, frame->stack);
+            memmove(frame->stack, callee, sizeof(aupVal) * (argc + 1));
+
+            STORE_FRAME();
+            vm->frameCount--;
+
+            if (!callValue(vm, *(vm->top = frame->stack), argc)) {
+                return AUP_RUNTIME_ERROR;
+            }
 
             LOAD_FRAME();
+            PREEMPT();
+            JIT_ENTER();
             NEXT;
         }
         CODE(RET) // ?isNil %RK
         {
             //closeUpvalues(vm, frame->stack);
+            // The bottom frame leaves its result in R(0) too,
+            // that is what a routine's task reports.
+            R(0) = A ? RKB : AUP_VNil;
             if (--vm->frameCount == 0) {
-                //pop();
+                // Past the last frame only the result is scanned.
+                vm->top = vm->stack + 1;
                 return AUP_OK;
             }
             //vm->top = frame->stack;
-            R(0) = A ? RKB : AUP_VNil;
             LOAD_FRAME();
+            JIT_ENTER();
             NEXT;
         }
 
         CODE(JMP) // %offset
         {
-            ip += Axx;
+            int offset = Axx;
+            ip += offset;
+            if (offset < 0) {
+                PREEMPT();
+            }
             NEXT;
         }
         CODE(JMPF) // %offset %RK
@@ -297,8 +592,44 @@ static int exec(aupVM *vm)
         CODE(JNE) // %offset %RK
         {
             int c = C;
+            CHECK_REGS(c - 1, 2);
             //if (!aup_isEqual(R(c - 1), R(c))) ip += Axx;
-            if (memcmp(&R(c-1), &R(c), sizeof(aupVal)) != 0) ip += Axx;
+            if (memcmp(&R(c-1), &R(c), sizeof(aupVal)) != 0 &&
+                !((AUP_IsRope(R(c-1)) || AUP_IsRope(R(c))) &&
+                  aup_isEqual(R(c-1), R(c)))) ip += Axx;
+            NEXT;
+        }
+        CODE(JLT) // ?jump %RK < %RK
+        {
+            left = RKB, right = RKC;
+            switch (AUP_PAIR(AUP_Typeof(left), AUP_Typeof(right))) {
+                case AUP_TNUM_NUM:
+                    QUICKEN(JLT_NN);
+                    BRANCH(AUP_AsNum(left) < AUP_AsNum(right));
+                    NEXT;
+                default:
+                    ERROR("Cannot perform < operator, got <%s> and <%s>.",
+                        aup_typeName(left), aup_typeName(right));
+                    return AUP_RUNTIME_ERROR;
+            }
+        }
+        CODE(JLE) // ?jump %RK <= %RK
+        {
+            left = RKB, right = RKC;
+            switch (AUP_PAIR(AUP_Typeof(left), AUP_Typeof(right))) {
+                case AUP_TNUM_NUM:
+                    QUICKEN(JLE_NN);
+                    BRANCH(AUP_AsNum(left) <= AUP_AsNum(right));
+                    NEXT;
+                default:
+                    ERROR("Cannot perform <= operator, got <%s> and <%s>.",
+                        aup_typeName(left), aup_typeName(right));
+                    return AUP_RUNTIME_ERROR;
+            }
+        }
+        CODE(JEQ) // ?jump %RK == %RK
+        {
+            BRANCH(aup_isEqual(RKB, RKC));
             NEXT;
         }
 
@@ -312,6 +643,7 @@ static int exec(aupVM *vm)
             left = RKB, right = RKC;
             switch (AUP_PAIR(AUP_Typeof(left), AUP_Typeof(right))) {
                 case AUP_TNUM_NUM:
+                    QUICKEN(LT_NN);
                     RA = AUP_VBool(AUP_AsNum(left) < AUP_AsNum(right));
                     NEXT;
                 default:
@@ -325,6 +657,7 @@ static int exec(aupVM *vm)
             left = RKB, right = RKC;
             switch (AUP_PAIR(AUP_Typeof(left), AUP_Typeof(right))) {
                 case AUP_TNUM_NUM:
+                    QUICKEN(LE_NN);
                     RA = AUP_VBool(AUP_AsNum(left) <= AUP_AsNum(right));
                     NEXT;
                 default:
@@ -338,6 +671,7 @@ static int exec(aupVM *vm)
             left = RKB, right = RKC;
             switch (AUP_PAIR(AUP_Typeof(left), AUP_Typeof(right))) {
                 case AUP_TNUM_NUM:
+                    QUICKEN(GT_NN);
                     RA = AUP_VBool(AUP_AsNum(left) > AUP_AsNum(right));
                     NEXT;
                 default:
@@ -351,6 +685,7 @@ static int exec(aupVM *vm)
             left = RKB, right = RKC;
             switch (AUP_PAIR(AUP_Typeof(left), AUP_Typeof(right))) {
                 case AUP_TNUM_NUM:
+                    QUICKEN(GE_NN);
                     RA = AUP_VBool(AUP_AsNum(left) >= AUP_AsNum(right));
                     NEXT;
                 default:
@@ -386,6 +721,7 @@ static int exec(aupVM *vm)
             left = RKB, right = RKC;
             switch (AUP_PAIR(AUP_Typeof(left), AUP_Typeof(right))) {
                 case AUP_TNUM_NUM:
+                    QUICKEN(ADD_NN);
                     RA = AUP_VNum(AUP_AsNum(left) + AUP_AsNum(right));
                     NEXT;
                 case AUP_TNUM_BOOL:
@@ -403,18 +739,23 @@ static int exec(aupVM *vm)
                 case AUP_TNUM_OBJ:
                     // TODO
                 case AUP_TOBJ_OBJ:
-                    // TODO
+                    if (!AUP_IsString(left) || !AUP_IsString(right)) break;
+                    STORE_PC();
+                    RA = AUP_VObj(aup_concat(left, right));
+                    NEXT;
                 default:
-                    ERROR("Cannot perform + operator, got <%s> and <%s>.",
-                        aup_typeName(left), aup_typeName(right));
-                    return AUP_RUNTIME_ERROR;
+                    break;
             }
+            ERROR("Cannot perform + operator, got <%s> and <%s>.",
+                aup_typeName(left), aup_typeName(right));
+            return AUP_RUNTIME_ERROR;
         }
         CODE(SUB) // %R = %RK - %RK
         {
             left = RKB, right = RKC;
             switch (AUP_PAIR(AUP_Typeof(left), AUP_Typeof(right))) {
                 case AUP_TNUM_NUM:
+                    QUICKEN(SUB_NN);
                     RA = AUP_VNum(AUP_AsNum(left) - AUP_AsNum(right));
                     NEXT;
                 default:
@@ -428,6 +769,7 @@ static int exec(aupVM *vm)
             left = RKB, right = RKC;
             switch (AUP_PAIR(AUP_Typeof(left), AUP_Typeof(right))) {
                 case AUP_TNUM_NUM:
+                    QUICKEN(MUL_NN);
                     RA = AUP_VNum(AUP_AsNum(left) * AUP_AsNum(right));
                     NEXT;
                 default:
@@ -441,6 +783,7 @@ static int exec(aupVM *vm)
             left = RKB, right = RKC;
             switch (AUP_PAIR(AUP_Typeof(left), AUP_Typeof(right))) {
                 case AUP_TNUM_NUM:
+                    QUICKEN(DIV_NN);
                     RA = AUP_VNum(AUP_AsNum(left) / AUP_AsNum(right));
                     NEXT;
                 default:
@@ -555,6 +898,98 @@ static int exec(aupVM *vm)
             }
         }
 
+        CODE(LT_NN) // %R = %RK < %RK (num, num)
+        {
+            left = RKB, right = RKC;
+            if (AUP_IsNum(left) && AUP_IsNum(right)) {
+                RA = AUP_VBool(AUP_AsNum(left) < AUP_AsNum(right));
+                NEXT;
+            }
+            DEQUICKEN(LT);
+        }
+        CODE(LE_NN) // %R = %RK <= %RK (num, num)
+        {
+            left = RKB, right = RKC;
+            if (AUP_IsNum(left) && AUP_IsNum(right)) {
+                RA = AUP_VBool(AUP_AsNum(left) <= AUP_AsNum(right));
+                NEXT;
+            }
+            DEQUICKEN(LE);
+        }
+        CODE(GT_NN) // %R = %RK > %RK (num, num)
+        {
+            left = RKB, right = RKC;
+            if (AUP_IsNum(left) && AUP_IsNum(right)) {
+                RA = AUP_VBool(AUP_AsNum(left) > AUP_AsNum(right));
+                NEXT;
+            }
+            DEQUICKEN(GT);
+        }
+        CODE(GE_NN) // %R = %RK >= %RK (num, num)
+        {
+            left = RKB, right = RKC;
+            if (AUP_IsNum(left) && AUP_IsNum(right)) {
+                RA = AUP_VBool(AUP_AsNum(left) >= AUP_AsNum(right));
+                NEXT;
+            }
+            DEQUICKEN(GE);
+        }
+        CODE(JLT_NN) // ?jump %RK < %RK (num, num)
+        {
+            left = RKB, right = RKC;
+            if (AUP_IsNum(left) && AUP_IsNum(right)) {
+                BRANCH(AUP_AsNum(left) < AUP_AsNum(right));
+                NEXT;
+            }
+            DEQUICKEN(JLT);
+        }
+        CODE(JLE_NN) // ?jump %RK <= %RK (num, num)
+        {
+            left = RKB, right = RKC;
+            if (AUP_IsNum(left) && AUP_IsNum(right)) {
+                BRANCH(AUP_AsNum(left) <= AUP_AsNum(right));
+                NEXT;
+            }
+            DEQUICKEN(JLE);
+        }
+
+        CODE(ADD_NN) // %R = %RK + %RK (num, num)
+        {
+            left = RKB, right = RKC;
+            if (AUP_IsNum(left) && AUP_IsNum(right)) {
+                RA = AUP_VNum(AUP_AsNum(left) + AUP_AsNum(right));
+                NEXT;
+            }
+            DEQUICKEN(ADD);
+        }
+        CODE(SUB_NN) // %R = %RK - %RK (num, num)
+        {
+            left = RKB, right = RKC;
+            if (AUP_IsNum(left) && AUP_IsNum(right)) {
+                RA = AUP_VNum(AUP_AsNum(left) - AUP_AsNum(right));
+                NEXT;
+            }
+            DEQUICKEN(SUB);
+        }
+        CODE(MUL_NN) // %R = %RK * %RK (num, num)
+        {
+            left = RKB, right = RKC;
+            if (AUP_IsNum(left) && AUP_IsNum(right)) {
+                RA = AUP_VNum(AUP_AsNum(left) * AUP_AsNum(right));
+                NEXT;
+            }
+            DEQUICKEN(MUL);
+        }
+        CODE(DIV_NN) // %R = %RK / %RK (num, num)
+        {
+            left = RKB, right = RKC;
+            if (AUP_IsNum(left) && AUP_IsNum(right)) {
+                RA = AUP_VNum(AUP_AsNum(left) / AUP_AsNum(right));
+                NEXT;
+            }
+            DEQUICKEN(DIV);
+        }
+
         CODE(MOV) // %R = %R
         {
             RA = RB;
@@ -566,16 +1001,14 @@ static int exec(aupVM *vm)
             NEXT;
         }
 
-        CODE(GLD) // %R = G.%K
+        CODE(GLD) // %R = G[%slot]
         {
-            aupStr *name = AUP_AsStr(KB);
-            aup_getKey(globals, name, &RA);
+            RA = aup_loadGlobal(&G(Bxx));
             NEXT;
         }
-        CODE(GST) // G.%K = %RK (?nil)
+        CODE(GST) // G[%slot] = %RK
         {
-            aupStr *name = AUP_AsStr(KA);
-            aup_setKey(globals, name, sC ? AUP_VNil : RKB);
+            aup_storeGlobal(&G(Axx), RKC);
             NEXT;
         }
 
@@ -586,27 +1019,28 @@ static int exec(aupVM *vm)
         }
         CODE(UST)
         {
-            U(A) = RKB;
+            aupUpv *upval = frame->function->upvals[A];
+            STORE_PC();
+            AUP_SetValue(upval, upval->location, RKB);
             NEXT;
         }
         CODE(OPEN)
         {
             aupFun *function = AUP_AsFun(KA);
+            STORE_PC();
             aup_makeClosure(function);
 
             for (int i = 0; i < function->upvalCount; i++) {
-                FETCH();
-                if (sB) {
-                    function->upvals[i] = captureUpval(vm, frame->stack + A);
-                }
-                else {
-                    function->upvals[i] = frame->function->upvals[A];
-                }
+                ip++;
+                aupUpv *upval = sB ? captureUpval(vm, frame->stack + A)
+                                   : frame->function->upvals[A];
+                AUP_SetObject(function, &function->upvals[i], upval);
             }
             NEXT;
         }
         CODE(CLOSE)
         {
+            STORE_PC();
             closeUpvals(vm, frame->stack + A);
             NEXT;
         }
@@ -628,15 +1062,77 @@ static int exec(aupVM *vm)
     return AUP_OK;
 }
 
+// Set up [callee] as the bottom frame of [vm], it starts
+// running on the next aup_resume().
+bool aup_prepare(aupVM *vm, aupVal callee, int argc, aupVal *args)
+{
+    resetStack(vm);
+
+    if (!AUP_IsFun(callee)) {
+        runtimeError(vm, "Can only run functions.");
+        return false;
+    }
+
+    if (argc + 1 > vm->stackSpace) {
+        growStack(vm, argc + 1);
+    }
+
+    vm->stack[0] = callee;
+    if (argc > 0) {
+        memcpy(vm->stack + 1, args, sizeof(aupVal) * argc);
+    }
+
+    return callValue(vm, callee, argc);
+}
+
+// Run [vm] for one time slice, returns AUP_YIELD if it has
+// to be resumed later.
+int aup_resume(aupVM *vm)
+{
+    vm->budget = AUP_TIMESLICE;
+    vm->blocked = false;
+    return exec(vm);
+}
+
+// Called from natives: give up the rest of the time slice.
+void aup_yield(aupVM *vm)
+{
+    vm->budget = 0;
+}
+
+// Called from natives: the call cannot complete yet, the
+// result is discarded and the call retried after yielding.
+// vm->blocked stays set until the VM is resumed.
+void aup_block(aupVM *vm)
+{
+    vm->blocked = true;
+}
+
 int aup_interpret(aupVM *vm, aupSrc *source)
 {
+    int status = AUP_COMPILE_ERROR;
+    aup_enterHeap();
+
     aupFun *function = aup_compile(vm, source);
-    if (function == NULL)
-        return AUP_COMPILE_ERROR;
+    if (function != NULL) {
+        status = AUP_RUNTIME_ERROR;
 
-    //push(OBJ_VAL(function));
-    *vm->top = AUP_VObj(function);
-    callValue(vm, AUP_VObj(function), 0);
+        if (aup_prepare(vm, AUP_VObj(function), 0, NULL)) {
+            unsigned seen = aup_finishedCount();
 
-    return exec(vm);
+            while ((status = aup_resume(vm)) == AUP_YIELD) {
+                // Not a routine, so wait here for one to finish
+                // rather than spin on a blocked call.
+                if (vm->blocked) {
+                    aup_leaveHeap();
+                    aup_waitFinished(seen);
+                    aup_enterHeap();
+                }
+                seen = aup_finishedCount();
+            }
+        }
+    }
+
+    aup_leaveHeap();
+    return status;
 }
@@ -6,8 +6,15 @@
 #include "value.h"
 #include "gc.h"
 
-#define AUP_MAX_FRAMES  64
-#define AUP_MAX_STACK   (AUP_MAX_FRAMES * UINT8_COUNT)
+// Both stacks start small and grow on demand.
+#define AUP_MIN_FRAMES  8
+#define AUP_MIN_STACK   64
+#define AUP_MAX_FRAMES  (1 << 16)
+#define AUP_MAX_STACK   (1 << 22)
+
+// Calls and backward jumps a VM may run before it has to
+// give its thread back.
+#define AUP_TIMESLICE   1024
 
 typedef struct {
     uint32_t *ip;
@@ -17,19 +24,37 @@ typedef struct {
 
 struct _aupVM {
     aupVal *top;
-    aupVal stack[AUP_MAX_STACK];
-    aupFrame frames[AUP_MAX_FRAMES];
+    aupVal *stack;
+    int stackSpace;
+    aupFrame *frames;
     int frameCount;
+    int frameSpace;
 
     int numRoots;
     aupObj *tempRoots[8];
     aupUpv *openUpvals;
 
+    int budget;
+    bool blocked;
+    aupTsk *task;
+
     aupVM *next;
+    aupVM *prev;
 };
 
 aupVM *aup_createVM(aupVM *from);
+aupVM *aup_createArenaVM(size_t limit);
 void aup_closeVM(aupVM *vm);
 int aup_interpret(aupVM *vm, aupSrc *source);
+void aup_defineNative(aupVM *vm, const char *name, aupCFn fn);
+
+bool aup_prepare(aupVM *vm, aupVal callee, int argc, aupVal *args);
+int aup_resume(aupVM *vm);
+void aup_yield(aupVM *vm);
+void aup_block(aupVM *vm);
+
+#ifdef AUP_OPSTATS
+void aup_dumpOpStats(int top);
+#endif
 
 #endif
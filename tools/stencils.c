@@ -0,0 +1,263 @@
+// Stencil templates for the baseline JIT, see src/jit.c.
+//
+// Never built into aup. tools/stencils.py compiles every function
+// here into a relocatable object and turns the machine code into the
+// tables of src/stencils.h; the _JIT_* symbols are the holes patched
+// for each instruction. Values are only handled where the interpreter
+// has a fast path of its own, anything else leaves to vm.c at the
+// same instruction, so the slow paths are never written twice.
+
+#include <math.h>
+#include <string.h>
+
+#include "../src/gc.h"
+#include "../src/object.h"
+
+typedef int aupJitFn(aupVal *regs);
+
+// Weak, or the compiler takes the address of a hole for non-null
+// and folds away a patched 0.
+#define HOLE        extern __attribute__((weak))
+
+// Byte offsets of the A, B and C registers in the frame
+HOLE char _JIT_RA[], _JIT_RB[], _JIT_RC[];
+// Constants of the B and C operands, and a global slot
+HOLE aupVal _JIT_KB, _JIT_KC, _JIT_GLOBAL;
+// Raw operand (a branch's expected outcome, a boolean literal)
+HOLE char _JIT_IMM[];
+// Instruction the interpreter carries on from
+HOLE char _JIT_PC[];
+// Code of the next instruction, and of a jump's target
+HOLE aupJitFn _JIT_NEXT, _JIT_TARGET;
+
+#define REG(hole)   (*(aupVal *)((char *)regs + (uintptr_t)(hole)))
+
+#define RA          REG(_JIT_RA)
+#define RB          REG(_JIT_RB)
+#define RC          REG(_JIT_RC)
+
+#if AUP_STENCIL_KB
+#define RKB         _JIT_KB
+#else
+#define RKB         RB
+#endif
+#if AUP_STENCIL_KC
+#define RKC         _JIT_KC
+#else
+#define RKC         RC
+#endif
+
+#define IMM         ((uintptr_t)_JIT_IMM)
+
+#define NEXT        return _JIT_NEXT(regs)
+#define JUMP        return _JIT_TARGET(regs)
+#define EXIT        return (int)(uintptr_t)_JIT_PC
+
+#define STENCIL(x)  int aup_stencil_##x(aupVal *regs)
+
+// Both operands numbers, or back to the interpreter
+#define NUMS() \
+    aupVal left = RKB, right = RKC; \
+    if (!AUP_IsNum(left) || !AUP_IsNum(right)) EXIT
+
+// aup_isEqual, numbers without the call
+static inline bool equal(aupVal left, aupVal right)
+{
+    if (AUP_IsNum(left) && AUP_IsNum(right)) {
+        return AUP_AsNum(left) == AUP_AsNum(right);
+    }
+    return aup_isEqual(left, right);
+}
+#define EQUAL()     equal(RKB, RKC)
+
+STENCIL(EXIT)
+{
+    EXIT;
+}
+
+// Also a forward JMP, with NEXT at its target
+STENCIL(NOP)
+{
+    NEXT;
+}
+
+STENCIL(NIL)
+{
+    RA = AUP_VNil;
+    NEXT;
+}
+STENCIL(BOOL)
+{
+    RA = AUP_VBool(IMM);
+    NEXT;
+}
+
+STENCIL(JMPF)
+{
+    if (!AUP_IsFalsey(RKC)) NEXT;
+    JUMP;
+}
+STENCIL(JNE)
+{
+    // B holds C - 1
+    if (memcmp(&RB, &RC, sizeof(aupVal)) == 0 ||
+        ((AUP_IsRope(RB) || AUP_IsRope(RC)) &&
+         aup_isEqual(RB, RC))) NEXT;
+    JUMP;
+}
+STENCIL(JLT)
+{
+    NUMS();
+    if ((AUP_AsNum(left) < AUP_AsNum(right)) != IMM) NEXT;
+    JUMP;
+}
+STENCIL(JLE)
+{
+    NUMS();
+    if ((AUP_AsNum(left) <= AUP_AsNum(right)) != IMM) NEXT;
+    JUMP;
+}
+STENCIL(JEQ)
+{
+    if (EQUAL() != IMM) NEXT;
+    JUMP;
+}
+
+STENCIL(NOT)
+{
+    RA = AUP_VBool(AUP_IsFalsey(RKB));
+    NEXT;
+}
+STENCIL(LT)
+{
+    NUMS();
+    RA = AUP_VBool(AUP_AsNum(left) < AUP_AsNum(right));
+    NEXT;
+}
+STENCIL(LE)
+{
+    NUMS();
+    RA = AUP_VBool(AUP_AsNum(left) <= AUP_AsNum(right));
+    NEXT;
+}
+STENCIL(GT)
+{
+    NUMS();
+    RA = AUP_VBool(AUP_AsNum(left) > AUP_AsNum(right));
+    NEXT;
+}
+STENCIL(GE)
+{
+    NUMS();
+    RA = AUP_VBool(AUP_AsNum(left) >= AUP_AsNum(right));
+    NEXT;
+}
+STENCIL(EQ)
+{
+    RA = AUP_VBool(EQUAL());
+    NEXT;
+}
+
+STENCIL(NEG)
+{
+    aupVal right = RKB;
+    if (!AUP_IsNum(right)) EXIT;
+    RA = AUP_VNum(-AUP_AsNum(right));
+    NEXT;
+}
+STENCIL(ADD)
+{
+    NUMS();
+    RA = AUP_VNum(AUP_AsNum(left) + AUP_AsNum(right));
+    NEXT;
+}
+STENCIL(SUB)
+{
+    NUMS();
+    RA = AUP_VNum(AUP_AsNum(left) - AUP_AsNum(right));
+    NEXT;
+}
+STENCIL(MUL)
+{
+    NUMS();
+    RA = AUP_VNum(AUP_AsNum(left) * AUP_AsNum(right));
+    NEXT;
+}
+STENCIL(DIV)
+{
+    NUMS();
+    RA = AUP_VNum(AUP_AsNum(left) / AUP_AsNum(right));
+    NEXT;
+}
+STENCIL(MOD)
+{
+    NUMS();
+    RA = AUP_VNum(fmod(AUP_AsNum(left), AUP_AsNum(right)));
+    NEXT;
+}
+STENCIL(POW)
+{
+    NUMS();
+    RA = AUP_VNum(pow(AUP_AsNum(left), AUP_AsNum(right)));
+    NEXT;
+}
+
+STENCIL(BNOT)
+{
+    aupVal right = RKB;
+    if (!AUP_IsNum(right)) EXIT;
+    RA = AUP_VNum(~AUP_AsI64(right));
+    NEXT;
+}
+STENCIL(BAND)
+{
+    NUMS();
+    RA = AUP_VNum(AUP_AsI64(left) & AUP_AsI64(right));
+    NEXT;
+}
+STENCIL(BOR)
+{
+    NUMS();
+    RA = AUP_VNum(AUP_AsI64(left) | AUP_AsI64(right));
+    NEXT;
+}
+STENCIL(BXOR)
+{
+    NUMS();
+    RA = AUP_VNum(AUP_AsI64(left) ^ AUP_AsI64(right));
+    NEXT;
+}
+STENCIL(SHL)
+{
+    NUMS();
+    RA = AUP_VNum(AUP_AsI64(left) << AUP_AsI64(right));
+    NEXT;
+}
+STENCIL(SHR)
+{
+    NUMS();
+    RA = AUP_VNum(AUP_AsI64(left) >> AUP_AsI64(right));
+    NEXT;
+}
+
+STENCIL(MOV)
+{
+    RA = RB;
+    NEXT;
+}
+STENCIL(LD)
+{
+    RA = RKB;
+    NEXT;
+}
+
+STENCIL(GLD)
+{
+    RA = aup_loadGlobal(&_JIT_GLOBAL);
+    NEXT;
+}
+STENCIL(GST)
+{
+    aup_storeGlobal(&_JIT_GLOBAL, RKC);
+    NEXT;
+}
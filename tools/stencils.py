@@ -0,0 +1,327 @@
+#!/usr/bin/env python3
+# Builds src/stencils.h, the machine code tables of the baseline JIT.
+#
+#   python3 tools/stencils.py [cc]
+#
+# Every aup_stencil_* function of tools/stencils.c is compiled for
+# each representation of values and each mix of register/constant
+# operands, then copied out of the object file with the relocations
+# it needs. Needs an x86-64 ELF toolchain (cc and objdump), run it
+# again whenever the templates or the value layouts change.
+
+import os
+import re
+import struct
+import subprocess
+import sys
+import tempfile
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SOURCE = os.path.join(ROOT, 'tools', 'stencils.c')
+OUTPUT = os.path.join(ROOT, 'src', 'stencils.h')
+
+CFLAGS = [
+    '-std=gnu11', '-O2', '-c',
+    # Every address is a 64-bit immediate, each stencil its own
+    # section, no tables or frames the copy would leave behind.
+    '-fno-pic', '-mcmodel=large', '-ffunction-sections',
+    '-fno-jump-tables', '-fno-asynchronous-unwind-tables',
+    '-fno-stack-protector', '-fcf-protection=none', '-fno-plt',
+]
+
+PREFIX = 'aup_stencil_'
+R_X86_64_64 = 1
+
+# Holes patched per instruction, see aupHoleKind in src/jit.c
+HOLES = {
+    '_JIT_RA': 'AUP_HOLE_RA',
+    '_JIT_RB': 'AUP_HOLE_RB',
+    '_JIT_RC': 'AUP_HOLE_RC',
+    '_JIT_KB': 'AUP_HOLE_KB',
+    '_JIT_KC': 'AUP_HOLE_KC',
+    '_JIT_GLOBAL': 'AUP_HOLE_GLOBAL',
+    '_JIT_IMM': 'AUP_HOLE_IMM',
+    '_JIT_PC': 'AUP_HOLE_PC',
+    '_JIT_NEXT': 'AUP_HOLE_NEXT',
+    '_JIT_TARGET': 'AUP_HOLE_TARGET',
+}
+CONTINUATIONS = ('_JIT_NEXT', '_JIT_TARGET')
+
+
+def fail(message):
+    sys.exit('stencils.py: ' + message)
+
+
+class Elf:
+    def __init__(self, blob):
+        if blob[:4] != b'\x7fELF' or blob[4] != 2 or blob[18] != 62:
+            fail('not an x86-64 ELF object')
+        shoff, = struct.unpack_from('<Q', blob, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from('<HHH', blob, 0x3A)
+
+        self.blob = blob
+        self.sections = []
+        for i in range(shnum):
+            (name, kind, flags, addr, offset, size, link, info,
+             align, entsize) = struct.unpack_from(
+                '<IIQQQQIIQQ', blob, shoff + i * shentsize)
+            self.sections.append(dict(name=name, kind=kind, offset=offset,
+                size=size, link=link, info=info, entsize=entsize))
+
+        strtab = self.sections[shstrndx]
+        for section in self.sections:
+            section['name'] = self.string(strtab, section['name'])
+
+        self.symbols = []
+        for section in self.sections:
+            if section['kind'] != 2:        # SHT_SYMTAB
+                continue
+            names = self.sections[section['link']]
+            for i in range(section['size'] // 24):
+                name, info, other, shndx, value, size = struct.unpack_from(
+                    '<IBBHQQ', blob, section['offset'] + i * 24)
+                self.symbols.append(dict(name=self.string(names, name),
+                    kind=info & 0xF, shndx=shndx, value=value, size=size))
+
+    def string(self, section, offset):
+        start = section['offset'] + offset
+        return self.blob[start:self.blob.index(b'\0', start)].decode()
+
+    def data(self, section):
+        return self.blob[section['offset']:section['offset'] + section['size']]
+
+    def relocations(self, index):
+        for section in self.sections:
+            if section['kind'] != 4 or section['info'] != index:
+                continue                    # SHT_RELA
+            for i in range(section['size'] // 24):
+                offset, info, addend = struct.unpack_from(
+                    '<QQq', self.blob, section['offset'] + i * 24)
+                yield offset, info & 0xFFFFFFFF, self.symbols[info >> 32], addend
+
+
+# objdump -d, by function: [(offset, size, mnemonic, operands)]
+def disassemble(path):
+    functions, current = {}, None
+    for line in subprocess.run(['objdump', '-d', '--no-show-raw-insn', path],
+            check=True, capture_output=True, text=True).stdout.splitlines():
+        header = re.match(r'^[0-9a-f]+ <(\w+)>:$', line)
+        if header:
+            current = functions.setdefault(header.group(1), [])
+            continue
+        insn = re.match(r'^\s+([0-9a-f]+):\s+(\S+)\s*(.*)$', line)
+        if insn and current is not None:
+            current.append((int(insn.group(1), 16), insn.group(2),
+                insn.group(3).split('#')[0].strip()))
+    return functions
+
+
+def aliases(register):
+    name = register[1:]
+    if re.match(r'^r\d+$', name):
+        return {'%' + name + suffix for suffix in ('', 'd', 'w', 'b')}
+    base = name[1:]
+    low = base[0] + 'l' if base.endswith('x') else base + 'l'
+    return {'%r' + base, '%e' + base, '%' + base, '%' + low}
+
+
+def writes(insn, register):
+    mnemonic, operands = insn[1], insn[2]
+    if mnemonic.startswith('call'):
+        return True
+    destination = operands.split(',')[-1]
+    return destination in aliases(register) and (
+        ',' in operands or mnemonic.startswith('pop'))
+
+
+# The bytes a stencil can drop when its next instruction is laid
+# out right behind it: the final jmp, if it always goes to NEXT.
+def fallthrough(name, insns, size, holes):
+    loads = {offset - 2: symbol for offset, symbol in holes}
+    targets = set()
+    for offset, mnemonic, operands in insns:
+        if mnemonic.startswith('j') and not operands.startswith('*'):
+            targets.add(int(operands.split()[0], 16))
+        if mnemonic.startswith('call'):
+            register = operands.lstrip('*')
+            if jumpsTo(insns, insns.index((offset, mnemonic, operands)),
+                    register, loads) in CONTINUATIONS:
+                fail(name + ' calls a continuation instead of jumping')
+
+    last = insns[-1]
+    if last[1] != 'jmp' or not last[2].startswith('*%'):
+        return 0
+    register = last[2][1:]
+    index = len(insns) - 1
+    if jumpsTo(insns, index, register, loads) != '_JIT_NEXT':
+        return 0
+    start = next(i for i in range(index, -1, -1)
+        if writes(insns[i], register))
+    if any(insns[start][0] < target <= last[0] for target in targets):
+        return 0
+    return size - last[0]
+
+
+def jumpsTo(insns, index, register, loads):
+    for i in range(index - 1, -1, -1):
+        if writes(insns[i], register):
+            if insns[i][1] != 'movabs':
+                return None
+            return loads.get(insns[i][0])
+    return None
+
+
+def compile(cc, defines, directory):
+    path = os.path.join(directory, 'stencils%d.o' % len(os.listdir(directory)))
+    subprocess.run([cc] + CFLAGS + ['-D' + d for d in defines] +
+        ['-o', path, SOURCE], check=True)
+    return path
+
+
+def extract(path):
+    elf = Elf(open(path, 'rb').read())
+    insns = disassemble(path)
+    stencils = {}
+
+    for symbol in elf.symbols:
+        if symbol['kind'] != 2 or not symbol['name'].startswith(PREFIX):
+            continue                        # STT_FUNC
+        name = symbol['name'][len(PREFIX):]
+        index = symbol['shndx']
+        section = elf.sections[index]
+        start = symbol['value']
+        code = elf.data(section)[start:start + symbol['size']]
+
+        holes, data, places, named = [], b'', {}, []
+        for offset, kind, target, addend in elf.relocations(index):
+            if kind != R_X86_64_64:
+                fail('%s: relocation type %d' % (name, kind))
+            offset -= start
+            if target['name'] in HOLES:
+                holes.append((offset, HOLES[target['name']], 'NULL', addend))
+                named.append((offset, target['name']))
+            elif target['shndx'] == 0:
+                # A C function the stencil calls
+                holes.append((offset, 'AUP_HOLE_SYM',
+                    '(const void *)&' + target['name'], addend))
+            else:
+                # Read-only constants, copied along with the code
+                source = elf.sections[target['shndx']]
+                if not source['name'].startswith('.rodata'):
+                    fail('%s: refers to %s' % (name, source['name']))
+                if source['name'] not in places:
+                    data += b'\0' * (-len(data) % 16)
+                    places[source['name']] = len(data)
+                    data += elf.data(source)
+                holes.append((offset, 'AUP_HOLE_DATA', 'NULL',
+                    places[source['name']] + target['value'] + addend))
+
+        trim = fallthrough(name, insns[symbol['name']], len(code), named)
+        stencils[name] = (code, trim, data, tuple(sorted(holes)))
+    return stencils
+
+
+def bytesOf(blob, indent):
+    lines = []
+    for i in range(0, len(blob), 12):
+        lines.append(indent + ' '.join('0x%02x,' % b for b in blob[i:i + 12]))
+    return '\n'.join(lines)
+
+
+def emit(out, variants, names):
+    unique = {}
+    table = []
+    for name in names:
+        row = []
+        for stencil in variants:
+            key = stencil[name]
+            if key not in unique:
+                unique[key] = len(unique)
+                code, trim, data, holes = key
+                n = unique[key]
+                out.append('static const uint8_t aup_stencilCode%d[] = {' % n)
+                out.append(bytesOf(code, '    '))
+                out.append('};')
+                if data:
+                    out.append('static const uint8_t aup_stencilData%d[] = {' % n)
+                    out.append(bytesOf(data, '    '))
+                    out.append('};')
+                if holes:
+                    out.append('static const aupHole aup_stencilHoles%d[] = {' % n)
+                    for offset, kind, symbol, addend in holes:
+                        out.append('    { %d, %s, %s, %d },' %
+                            (offset, kind, symbol, addend))
+                    out.append('};')
+            n = unique[key]
+            code, trim, data, holes = key
+            row.append('{ aup_stencilCode%d, %d, %d, %s, %d, %s, %d }' % (n,
+                len(code), trim,
+                'aup_stencilData%d' % n if data else 'NULL', len(data),
+                'aup_stencilHoles%d' % n if holes else 'NULL', len(holes)))
+        table.append(row)
+
+    out.append('')
+    out.append('static const aupStencil aup_stencils[AUP_STENCIL_COUNT][4] = {')
+    for name, row in zip(names, table):
+        out.append('    [AUP_STENCIL_%s] = {' % name)
+        for entry in row:
+            out.append('        %s,' % entry)
+        out.append('    },')
+    out.append('};')
+
+
+def main():
+    cc = sys.argv[1] if len(sys.argv) > 1 else os.environ.get('CC', 'cc')
+    out = [
+        '// Generated by tools/stencils.py from tools/stencils.c, do not edit.',
+        '',
+        '#ifndef _AUP_STENCILS_H',
+        '#define _AUP_STENCILS_H',
+        '#pragma once',
+        '',
+    ]
+
+    with tempfile.TemporaryDirectory() as directory:
+        tables, names = [], None
+        for boxing in (False, True):
+            variants = []
+            # Indexed by sB << 1 | sC
+            for kb in (0, 1):
+                for kc in (0, 1):
+                    defines = ['AUP_STENCIL_KB=%d' % kb,
+                               'AUP_STENCIL_KC=%d' % kc]
+                    if boxing:
+                        defines.append('AUP_NAN_BOXING')
+                    variants.append(extract(compile(cc, defines, directory)))
+            order = list(variants[0])
+            if names is None:
+                names = order
+            elif order != names:
+                fail('stencils differ between builds')
+            tables.append(variants)
+
+    out.append('typedef enum {')
+    for name in names:
+        out.append('    AUP_STENCIL_%s,' % name)
+    out.append('    AUP_STENCIL_COUNT')
+    out.append('} aupStencilKind;')
+    out.append('')
+
+    out.append('#ifdef AUP_NAN_BOXING')
+    out.append('')
+    emit(out, tables[1], names)
+    out.append('')
+    out.append('#else')
+    out.append('')
+    emit(out, tables[0], names)
+    out.append('')
+    out.append('#endif')
+    out.append('')
+    out.append('#endif')
+
+    with open(OUTPUT, 'w') as f:
+        f.write('\n'.join(out) + '\n')
+
+
+if __name__ == '__main__':
+    main()